@@ -27,6 +27,9 @@ namespace media
  */
 namespace S32K
 {
+/* Reception ISR of the driver, which fills the shared frames */
+class FlexCAN_interrupt;
+
 /**
  * Implementation of the methods from libuavcan's media layer abstracct class InterfaceGroup,
  * with the template arguments listed below; for further details of this interface class,
@@ -38,16 +41,319 @@ namespace S32K
  */
 class InterfaceGroup : public media::InterfaceGroup<media::CAN::Frame<media::CAN::TypeFD::MaxFrameSizeBytes>>
 {
-private:
+protected:
     /*
-     * Helper function for an immediate transmission through an available message buffer.
+     * Helper function for an immediate transmission request through an available message buffer, it doesn't wait
+     * for the frame to be transmitted, the completion is signaled by the message buffer's interrupt flag.
+     * @param [in]  iface_index  The FlexCAN instance number, starts at 0.
      * @param [in]  TX_MB_index  The index from an already polled available message buffer.
      * @param [in]  frame        The individual frame being transmitted.
+     * @param [in]  payload_swap False if the frame's payload is already in FlexCAN's byte order.
      * @return libuavcan::Result:Success after a successful transmission request.
      */
-    Result messageBuffer_Transmit(std::uint_fast8_t iface_index, std::uint8_t TX_MB_index, const FrameType& frame);
+    static Result messageBuffer_Transmit(std::uint_fast8_t iface_index,
+                                         std::uint8_t      TX_MB_index,
+                                         const FrameType&  frame,
+                                         bool              payload_swap = true);
 
 public:
+    /**
+     * Callback invoked from the reception ISR for each frame routed to a port registered with one,
+     * the frame's payload is already in little-endian byte order.
+     * @param [in]  interface_index  The index of the interface where the frame was received, starts at 1.
+     * @param [in]  frame            The received frame, only valid for the duration of the call.
+     */
+    using PortCallback = void (*)(std::uint_fast8_t interface_index, const FrameType& frame);
+
+    /**
+     * Handle of a received frame shared by the subscribers of a port, the frame is stored once in a slot of a pool
+     * and copying the handle only adds a reference to the slot. The slot returns to the pool when its last handle is
+     * reset or destroyed. The reference counts are atomics, so handles can be copied and dropped from any context,
+     * ISR's included.
+     */
+    class FrameRef
+    {
+    public:
+        /**
+         * Create an empty handle.
+         */
+        FrameRef();
+
+        /**
+         * Create a handle sharing the frame of another one.
+         * @param [in]  rhs  The handle whose frame is shared.
+         */
+        FrameRef(const FrameRef& rhs);
+
+        /**
+         * Share the frame of another handle, dropping the reference to the previous one.
+         * @param [in]  rhs  The handle whose frame is shared.
+         * @return This handle.
+         */
+        FrameRef& operator=(const FrameRef& rhs);
+
+        ~FrameRef();
+
+        /**
+         * Drop the reference to the frame, leaving the handle empty.
+         */
+        void reset();
+
+        /**
+         * Get the shared frame, its payload is in little-endian byte order.
+         * @return The frame, nullptr if the handle is empty.
+         */
+        const FrameType* get() const;
+
+        const FrameType& operator*() const
+        {
+            return *get();
+        }
+
+        const FrameType* operator->() const
+        {
+            return get();
+        }
+
+        explicit operator bool() const
+        {
+            return slot_ != Empty;
+        }
+
+    private:
+        friend class FlexCAN_interrupt;
+
+        /* Slot index of an empty handle */
+        static constexpr std::uint8_t Empty = 0xFFu;
+
+        /* Adopt the reference to a slot taken from the pool */
+        explicit FrameRef(std::uint8_t slot);
+
+        std::uint8_t slot_;
+    };
+
+    /**
+     * Callback invoked from the reception ISR for each frame routed to a port, once per subscriber, all of them
+     * sharing the same frame.
+     * @param [in]  interface_index  The index of the interface where the frame was received, starts at 1.
+     * @param [in]  frame            Handle of the received frame, copying it keeps the frame past the call.
+     * @param [in]  context          The context pointer given to subscribePort().
+     */
+    using SharedCallback = void (*)(std::uint_fast8_t interface_index, const FrameRef& frame, void* context);
+
+    /**
+     * Maximum number of subscribers of a port.
+     */
+    static constexpr std::size_t MaxSubscribers = 4u;
+
+    /**
+     * Segment of a payload gathered by writeGather().
+     */
+    struct Segment
+    {
+        const std::uint8_t* data;   /**< Bytes of the segment. */
+        std::size_t         length; /**< Number of bytes of the segment. */
+    };
+
+    /**
+     * Admission policies applied by the reception ISR to an interface's shared frame queue.
+     */
+    enum class AdmissionPolicy : std::uint8_t
+    {
+        DropNewest,          /**< When the queue is full the received frame is discarded (default). */
+        EvictLowestPriority, /**< When the queue is full the queued frame with the greatest CAN ID is discarded if
+                                  the received frame has a higher priority, otherwise the received frame is. */
+        ReservePerClass      /**< The last slots of the queue are reserved for the higher UAVCAN priority classes,
+                                  a frame is discarded if fewer slots than its class' headroom are free. */
+    };
+
+    /**
+     * Counters of the frames discarded by the admission control of an interface's shared frame queue.
+     */
+    struct AdmissionStatistics
+    {
+        std::uint32_t dropped_full;     /**< Received frames discarded due to the queue being full. */
+        std::uint32_t evicted_priority; /**< Queued frames evicted by higher priority frames. */
+        std::uint32_t dropped_reserved; /**< Received frames discarded by their class' reserved headroom. */
+        std::uint32_t expired_age;      /**< Queued frames discarded by read() for exceeding the maximum age. */
+    };
+
+    /**
+     * Policies for choosing the interface of the frames written by writeBalanced().
+     */
+    enum class BalancePolicy : std::uint8_t
+    {
+        MostFreeMailboxes, /**< The interface with the most free transmission message buffers, then shortest queue. */
+        ShortestQueue,     /**< The interface with the fewest frames pending transmission. */
+        LowestBusLoad      /**< The interface with the lowest estimated bus load, transmitted and received bytes. */
+    };
+
+    /**
+     * Number of buckets of the latency histogram of the gateway.
+     */
+    static constexpr std::size_t GatewayLatencyBuckets = 8u;
+
+    /**
+     * Forwarding rule of the gateway, a received frame matches it if its CAN ID equals @ref id in the bits set in
+     * @ref mask. The bits set in @ref rewrite_mask are replaced by those of @ref rewrite_id in the forwarded frame.
+     */
+    struct ForwardRule
+    {
+        std::uint32_t id;           /**< CAN ID compared to the received frame's. */
+        std::uint32_t mask;         /**< Bits of the CAN ID compared. */
+        std::uint32_t rewrite_mask; /**< Bits of the CAN ID replaced when forwarding, 0 for no rewriting. */
+        std::uint32_t rewrite_id;   /**< Values of the replaced bits. */
+    };
+
+    /**
+     * Counters of one direction of the gateway, for the frames received by an interface.
+     */
+    struct GatewayStatistics
+    {
+        std::uint32_t forwarded;   /**< Frames copied straight into a transmission message buffer of the peer. */
+        std::uint32_t queued;      /**< Frames inserted in the transmission queue of the peer. */
+        std::uint32_t dropped;     /**< Frames dropped for the peer's queue being full or being too long for it. */
+        std::uint32_t latency_max; /**< Maximum latency of the forwarded frames in microseconds. */
+        std::uint32_t latency_histogram[GatewayLatencyBuckets]; /**< Forwarded frames by latency, bucket k counts the
+                                                                     latencies below 2^(k+3) microseconds and the
+                                                                     last one the rest. */
+    };
+
+    /**
+     * Counters of the reception message buffers of an interface.
+     */
+    struct ReceiveStatistics
+    {
+        std::uint32_t overrun; /**< Frames lost by a message buffer overwritten before being serviced, or by the
+                                    RX FIFO or eDMA ring of a classic instance overflowing. */
+        std::uint32_t torn;    /**< Flagged message buffers discarded for not holding a complete frame. */
+    };
+
+    /**
+     * Maximum number of periodic publications of the group.
+     */
+    static constexpr std::size_t MaxPublications = 8u;
+
+    /**
+     * Counters of a periodic publication.
+     */
+    struct PublicationStatistics
+    {
+        std::uint32_t published; /**< Frames loaded into the pinned message buffer or inserted in the queue. */
+        std::uint32_t skipped;   /**< Periods skipped for the previous frame still pending, the transmission queue
+                                      being full or the scheduler running late. */
+    };
+
+    /**
+     * Maximum number of transmission rate limits of each interface.
+     */
+    static constexpr std::size_t MaxRateLimits = 8u;
+
+    /**
+     * Token bucket limit of the transmission rate of the frames whose CAN ID equals @ref id in the bits set in
+     * @ref mask, e.g. the subject ID bits (20-8) for a subject or the priority bits (28-26) for a priority class.
+     * Each frame is charged its payload length plus 10 bytes of estimated overhead on the bus.
+     */
+    struct RateLimit
+    {
+        std::uint32_t id;    /**< CAN ID compared to the frame's. */
+        std::uint32_t mask;  /**< Bits of the CAN ID compared. */
+        std::uint32_t rate;  /**< Sustained rate in bytes per second the bucket refills at. */
+        std::uint32_t burst; /**< Capacity of the bucket in bytes, at least one 64-byte frame plus its overhead. */
+    };
+
+    /**
+     * Counters of a transmission rate limit.
+     */
+    struct RateLimitStatistics
+    {
+        std::uint32_t throttled; /**< Frames refused by write() or writeBalanced() for exceeding the limit. */
+        std::uint32_t available; /**< Bytes left in the bucket as of its last use. */
+    };
+
+    /**
+     * Counters of the reception storm protection of a filter.
+     */
+    struct StormStatistics
+    {
+        std::uint32_t events; /**< Times the filter's message buffers were masked for exceeding the threshold. */
+        std::uint32_t frames; /**< Frames received by the filter in the current window. */
+        bool          masked; /**< The filter's message buffers are masked, waiting for the back-off to elapse. */
+    };
+
+    /**
+     * Settings of the runtime tuning of an interface's filters from their hit statistics. The frames accepted by each
+     * filter are counted by the ISR per port, subject or service, along with the ones the application reports as
+     * rejected, and every epoch a tighter filter is proposed from the CAN ID bits common to the ports it still uses.
+     * The ports registered with registerPort() count as used even while quiet, only the ports the application
+     * rejects are filtered out.
+     */
+    struct FilterTuning
+    {
+        duration::Monotonic epoch;          /**< Length of the evaluation epochs, 0 disables the tuning. */
+        std::uint8_t        reject_percent; /**< Percentage of rejected frames in an epoch tightening a filter. */
+        std::uint8_t        stable_epochs;  /**< Consecutive epochs a proposal must hold before being applied. */
+        std::uint16_t       relearn_epochs; /**< Epochs after which tightened filters go back to the application's
+                                                 ones for learning the traffic again, 0 for never. */
+        bool                apply;          /**< Apply the stable proposals, otherwise they're only reported. */
+    };
+
+    /**
+     * Hit statistics of a filter for its runtime tuning, as of the last closed epoch.
+     */
+    struct FilterHitStatistics
+    {
+        std::uint32_t     accepted;  /**< Frames accepted by the filter in the epoch. */
+        std::uint32_t     rejected;  /**< Frames reported as rejected by the application in the epoch. */
+        FrameType::Filter proposed;  /**< Filter proposed, the applied one if it can't be tightened further. */
+        std::uint8_t      stable;    /**< Consecutive epochs the proposal held. */
+        bool              tightened; /**< The applied filter is tighter than the one set by the application. */
+    };
+
+    /**
+     * Bit of an interface in the readiness mask of select(), set while it has frames to read.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @return The bit of the interface's reception readiness.
+     */
+    static constexpr std::uint32_t readyRX(std::uint_fast8_t interface_index)
+    {
+        return 1u << (2u * (interface_index - 1u));
+    }
+
+    /**
+     * Bit of an interface in the readiness mask of select(), set while its transmission queue has room.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @return The bit of the interface's transmission readiness.
+     */
+    static constexpr std::uint32_t readyTX(std::uint_fast8_t interface_index)
+    {
+        return 2u << (2u * (interface_index - 1u));
+    }
+
+    /**
+     * Number of time-triggered frames each interface can hold scheduled.
+     */
+    static constexpr std::size_t CalendarLength = 4u;
+
+    /**
+     * Outcome of a time-triggered frame, both times in the time base of the received frames' timestamps.
+     */
+    struct TimedReport
+    {
+        libuavcan::time::Monotonic target; /**< Time at which the frame was scheduled to enter arbitration. */
+        libuavcan::time::Monotonic sof;    /**< Timestamp FlexCAN captured when transmitting the frame. */
+    };
+
+    /**
+     * Counters of the transmission path of an interface.
+     */
+    struct TransmitStatistics
+    {
+        std::uint32_t preempted; /**< Transmission MB's aborted for loading a more urgent frame. */
+        std::uint32_t requeued;  /**< Aborted frames put back in the transmission queue, the rest of the aborted
+                                      MB's had already won arbitration and were transmitted. */
+    };
+
     /**
      * Get the number of CAN-FD capable FlexCAN modules in current S32K14 MCU
      * @return 1-* depending of the target MCU.
@@ -55,15 +361,19 @@ public:
     virtual std::uint_fast8_t getInterfaceCount() const override;
 
     /**
-     * Send a frame through a particular available FlexCAN instance.
+     * Send a frame through a particular available FlexCAN instance. The frames are inserted in the interface's
+     * transmission queue, ordered by CAN ID, from which they are loaded into the transmission message buffers as
+     * soon as these become available, the TX interrupt keeps draining the queue.
      * @param [in]  interface_index  The index of the interface in the group to write the frames to.
      * @param [in]  frames           1..MaxTxFrames frames to write into the system queues for immediate transmission.
      * @param [in]  frames_len       The number of frames in the frames array that should be sent
      *                          (starting from frame 0).
      * @param [out] out_frames_written
-     *                          Will return MaxTxFrames in current implementation if the frame was sent successfully
+     *                          The number of frames inserted in the transmission queue.
      * @return libuavcan::Result::Success     if all frames were written.
-     * @return libuavcan::Result::BadArgument if interface_index or frames_len are out of bound.
+     * @return libuavcan::Result::BufferFull  if the transmission queue is full or the frame exceeds its rate limit.
+     * @return libuavcan::Result::BadArgument if interface_index or frames_len are out of bound, or if a frame is
+     *                                        longer than 8 bytes for an interface in classic CAN mode.
      */
     virtual Result write(std::uint_fast8_t interface_index,
                          const FrameType (&frames)[TxFramesLen],
@@ -71,7 +381,106 @@ public:
                          std::size_t& out_frames_written) override;
 
     /**
-     * Read from an intermediate ISR Frame buffer of an FlexCAN instance.
+     * Send frames through the interface chosen by the balancing policy, spreading non-redundant traffic across the
+     * group. A frame goes to the interface that still holds a pending frame of the same subject or service, so the
+     * frames of each subject or service keep their order, or else to the best one under the policy. Interfaces in
+     * bus off state are skipped, so traffic fails over to the healthy ones.
+     * @param [in]  frames           1..MaxTxFrames frames to write into the system queues for immediate transmission.
+     * @param [in]  frames_len       The number of frames in the frames array that should be sent
+     *                          (starting from frame 0).
+     * @param [out] out_frames_written
+     *                          The number of frames inserted in a transmission queue.
+     * @return libuavcan::Result::Success        if all frames were written.
+     * @return libuavcan::Result::SuccessPartial if only the first out_frames_written frames were written.
+     * @return libuavcan::Result::BufferFull     if the chosen interface's queue is full or its rate limit exceeded.
+     * @return libuavcan::Result::Failure        if every interface is in bus off state.
+     * @return libuavcan::Result::BadArgument    if frames_len is out of bound.
+     */
+    Result writeBalanced(const FrameType (&frames)[TxFramesLen],
+                         std::size_t  frames_len,
+                         std::size_t& out_frames_written);
+
+    /**
+     * Loan the payload buffer of a transmission slot of an interface, for serializing a frame in place instead of
+     * building it in a temporary frame. When a transmission message buffer is idle, the buffer is the copy of the
+     * frame kept for that message buffer, which the commit loads straight into it, otherwise it is a staging frame
+     * inserted in the transmission queue by the commit. Each interface has one loan at a time, which is ended by
+     * commitFrame() or cancelLoan().
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [out] out_payload      Buffer of 64 bytes where the payload is written in little-endian order.
+     * @return libuavcan::Result::Success     if the buffer was loaned.
+     * @return libuavcan::Result::BufferFull  if the interface has a loan outstanding.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result loanFrame(std::uint_fast8_t interface_index, std::uint8_t*& out_payload);
+
+    /**
+     * Send the frame serialized in an interface's loaned buffer, the bytes between @p length and the next valid
+     * CAN-FD length are padded with zeros. The frame is loaded right into its loaned message buffer if its lane
+     * accepts it and no queued frame goes first, otherwise it is inserted in the transmission queue. The loan ends
+     * unless the frame is refused.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  id               The CAN ID of the frame.
+     * @param [in]  length           The length in bytes of the payload.
+     * @return libuavcan::Result::Success     if the frame was loaded or queued.
+     * @return libuavcan::Result::BufferFull  if the transmission queue is full or the frame exceeds its rate limit,
+     *                                        the loan is kept for retrying.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound, there's no loan outstanding, or the
+     *                                        payload is longer than 64 bytes, or than 8 bytes in classic CAN mode.
+     */
+    Result commitFrame(std::uint_fast8_t interface_index, std::uint32_t id, std::size_t length);
+
+    /**
+     * End an interface's loan without sending its frame.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @return libuavcan::Result::Success     if the loan was ended.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or there's no loan outstanding.
+     */
+    Result cancelLoan(std::uint_fast8_t interface_index);
+
+    /**
+     * Send a frame whose payload is gathered from several segments, e.g. a transfer header and its serialized
+     * payload, copied straight into a loaned buffer as by loanFrame() and commitFrame().
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  id               The CAN ID of the frame.
+     * @param [in]  segments         The segments of the payload, in order.
+     * @param [in]  segments_length  The number of segments.
+     * @return libuavcan::Result::Success     if the frame was loaded or queued.
+     * @return libuavcan::Result::BufferFull  if the interface has a loan outstanding, the transmission queue is full
+     *                                        or the frame exceeds its rate limit.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or the segments add up to a payload
+     *                                        longer than 64 bytes, or than 8 bytes in classic CAN mode.
+     */
+    Result writeGather(std::uint_fast8_t interface_index,
+                       std::uint32_t     id,
+                       const Segment*    segments,
+                       std::size_t       segments_length);
+
+    /**
+     * Submit a frame for transmission from any context, including interrupt handlers of any priority, unlike write()
+     * which is reserved to the main loop. The frame is posted to a lock-free ring of the interface and the interface's
+     * interrupt is pended, whose handler moves the submitted frames into the transmission queue and loads the idle
+     * message buffers, so the frame reaches the bus as soon as the submitting handler returns. The rate limits are
+     * applied when the frame is moved, a throttled frame is dropped and counted by its limit.
+     * @param [in]  interface_index  The index of the interface, starts at 1, of a started group.
+     * @param [in]  frame            The frame to transmit.
+     * @return libuavcan::Result::Success     if the frame was submitted.
+     * @return libuavcan::Result::BufferFull  if the interface's submission ring is full.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound, or the payload is longer than 8
+     *                                        bytes in classic CAN mode.
+     */
+    Result submit(std::uint_fast8_t interface_index, const FrameType& frame);
+
+    /**
+     * Select the policy of writeBalanced(), MostFreeMailboxes by default.
+     * @param [in]  policy  The balancing policy.
+     * @return libuavcan::Result::Success     if the policy was selected.
+     */
+    Result setBalancePolicy(BalancePolicy policy);
+
+    /**
+     * Read from an intermediate ISR Frame buffer of an FlexCAN instance. Interfaces in classic CAN mode are read from
+     * the eDMA ring of their RX FIFO instead, bypassing the dispatch stage and the admission control.
      * @param [in]   interface_index  The index of the interface in the group to read the frames from.
      * @param [out]  out_frames       A buffer of frames to read.
      * @param [out]  out_frames_read  On output the number of frames read into the out_frames array.
@@ -82,6 +491,381 @@ public:
                         FrameType (&out_frames)[RxFramesLen],
                         std::size_t& out_frames_read) override;
 
+    /**
+     * Read the frame received earliest by any interface of the group, by hardware timestamp, along with the index of
+     * its interface. The next frame of each interface is taken as its head and the earliest head is returned, a k-way
+     * merge of the interfaces' queues, so frames of redundant buses come out in arrival order. A head not returned
+     * yet is returned first by read() of its interface.
+     * @param [out]  out_frames           A buffer of frames to read.
+     * @param [out]  out_frames_read      On output the number of frames read into the out_frames array.
+     * @param [out]  out_interface_index  The index of the interface the frame was read from, 0 if none.
+     * @return libuavcan::Result::Success        if a frame was read.
+     * @return libuavcan::Result::SuccessNothing if no interface had frames to read.
+     */
+    Result readMerged(FrameType (&out_frames)[RxFramesLen],
+                      std::size_t&       out_frames_read,
+                      std::uint_fast8_t& out_interface_index);
+
+    /**
+     * Register a UAVCAN port in the reception dispatch stage of an interface, frames whose CAN ID decodes to the
+     * given subject or service ID are routed to a bounded queue owned by the port, or to @p callback if one is
+     * given, instead of the interface's shared queue. Ports are meant to be registered at initialization.
+     * @param [in]  interface_index  The index of the interface whose dispatch table is extended.
+     * @param [in]  port_id          Subject ID (0-8191) for messages or service ID (0-511) for services.
+     * @param [in]  is_service       True if @p port_id is a service ID, false if it is a subject ID.
+     * @param [in]  callback         Optional function called from the ISR instead of queueing the frames.
+     * @return libuavcan::Result::Success     if the port was registered or was already registered.
+     * @return libuavcan::Result::BufferFull  if the dispatch table of the interface is full.
+     * @return libuavcan::Result::BadArgument if interface_index or port_id are out of bound.
+     */
+    Result registerPort(std::uint_fast8_t interface_index,
+                        std::uint16_t     port_id,
+                        bool              is_service,
+                        PortCallback      callback = nullptr);
+
+    /**
+     * Subscribe to a UAVCAN port of an interface, registering it in the dispatch stage if it isn't. Each frame of a
+     * port with subscribers is copied once out of its message buffer into a pool slot and handed to every subscriber
+     * as a FrameRef, instead of being queued or passed to the port's callback. A frame is dropped, and counted as
+     * discarded by the port, if every slot of the pool is still referenced.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  port_id          Subject ID (0-8191) for messages or service ID (0-511) for services.
+     * @param [in]  is_service       True if @p port_id is a service ID, false if it is a subject ID.
+     * @param [in]  callback         Function called from the ISR with each frame.
+     * @param [in]  context          Pointer passed back to @p callback.
+     * @return libuavcan::Result::Success     if the subscriber was added or was already subscribed.
+     * @return libuavcan::Result::BufferFull  if the dispatch table or the port's subscribers are full.
+     * @return libuavcan::Result::BadArgument if interface_index or port_id are out of bound, or callback is nullptr.
+     */
+    Result subscribePort(std::uint_fast8_t interface_index,
+                         std::uint16_t     port_id,
+                         bool              is_service,
+                         SharedCallback    callback,
+                         void*             context);
+
+    /**
+     * Read from the dedicated queue of a port previously registered without a callback.
+     * @param [in]   interface_index  The index of the interface in the group to read the frames from.
+     * @param [in]   port_id          Subject or service ID of the port.
+     * @param [in]   is_service       True if @p port_id is a service ID, false if it is a subject ID.
+     * @param [out]  out_frames       A buffer of frames to read.
+     * @param [out]  out_frames_read  On output the number of frames read into the out_frames array.
+     * @return libuavcan::Result::Success        If a frame was read.
+     * @return libuavcan::Result::SuccessNothing If the port's queue is empty.
+     * @return libuavcan::Result::NotFound       If the port isn't registered in the interface's dispatch table.
+     * @return libuavcan::Result::BadArgument    If interface_index is out of bound.
+     */
+    Result readPort(std::uint_fast8_t interface_index,
+                    std::uint16_t     port_id,
+                    bool              is_service,
+                    FrameType (&out_frames)[RxFramesLen],
+                    std::size_t& out_frames_read);
+
+    /**
+     * Enable or disable the preemption of the transmission message buffers of an interface. When enabled and a frame
+     * with higher priority than every loaded message buffer is at the head of the transmission queue, the message
+     * buffer with the lowest priority frame is aborted without blocking, once the abort completes the interrupt
+     * handler puts the aborted frame back in the queue, in a slot reserved when the abort was requested so it's never
+     * lost, and loads the urgent frame. No message buffer is preempted while the transmission queue is full.
+     * @param [in]  interface_index  The index of the interface to configure.
+     * @param [in]  enable           True for enabling the preemption, it is disabled by default.
+     * @return libuavcan::Result::Success     if the preemption was configured.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result setTransmitPreemption(std::uint_fast8_t interface_index, bool enable);
+
+    /**
+     * Reserve a transmission message buffer (lane) of an interface for a range of UAVCAN priority classes, e.g. one
+     * MB only for the exceptional and immediate classes and the rest shared, so that high priority traffic always
+     * has a MB ready. Each frame's own priority class is loaded as the MB's FlexCAN local priority (LPRIO), not the
+     * lane's, so an urgent frame in a shared lane never loses local arbitration to a less urgent one held in a
+     * reserved lane. By default every lane accepts every class. The configuration is reset by startInterfaceGroup().
+     * @param [in]  interface_index  The index of the interface to configure.
+     * @param [in]  lane             Index of the transmission MB, 0 or 1.
+     * @param [in]  lowest_priority  Lowest UAVCAN priority class (0 exceptional - 7 optional) the lane accepts.
+     * @return libuavcan::Result::Success     if the lane was configured.
+     * @return libuavcan::Result::BadArgument if interface_index, lane or lowest_priority are out of bound.
+     */
+    Result setTransmitLane(std::uint_fast8_t interface_index, std::uint8_t lane, std::uint8_t lowest_priority);
+
+    /**
+     * Get the counters of the transmission path of an interface.
+     * @param [in]   interface_index  The index of the interface whose counters are read.
+     * @param [out]  out_statistics   Snapshot of the counters.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result getTransmitStatistics(std::uint_fast8_t interface_index, TransmitStatistics& out_statistics) const;
+
+    /**
+     * Switch an interface between interrupt and polling reception. In polling mode the interrupts of the RX message
+     * buffers are masked and read() drains a ready MB straight into the caller's frame, fusing the byte swap with the
+     * copy, this removes the interrupt entry and queueing costs for nodes that spin on read() at high frame rates.
+     * Polled frames bypass the dispatch stage and the admission control of the shared queue, frames that were already
+     * queued are returned first. Can be selected before or after startInterfaceGroup(). It has no effect on
+     * interfaces in classic CAN mode, which are always drained by eDMA.
+     * @param [in]  interface_index  The index of the interface to configure.
+     * @param [in]  enable           True for polling mode, false for interrupt mode (default).
+     * @return libuavcan::Result::Success     if the mode was configured.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result setPollingMode(std::uint_fast8_t interface_index, bool enable);
+
+    /**
+     * Select the admission control of the shared frame queue of an interface, which is the one served by read().
+     * @param [in]  interface_index  The index of the interface whose queue is configured.
+     * @param [in]  policy           Policy applied by the ISR for admitting received frames.
+     * @param [in]  max_frame_age    Queued frames older than this are discarded by read(), 0 disables the aging.
+     * @return libuavcan::Result::Success     if the admission control was configured.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result setAdmissionPolicy(std::uint_fast8_t   interface_index,
+                              AdmissionPolicy     policy,
+                              duration::Monotonic max_frame_age = duration::Monotonic::fromMicrosecond(0));
+
+    /**
+     * Get the counters of frames discarded by the admission control of an interface's shared frame queue.
+     * @param [in]   interface_index  The index of the interface whose counters are read.
+     * @param [out]  out_statistics   Snapshot of the counters.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result getAdmissionStatistics(std::uint_fast8_t interface_index, AdmissionStatistics& out_statistics) const;
+
+    /**
+     * Get the counters of the reception message buffers of an interface.
+     * @param [in]   interface_index  The index of the interface whose counters are read.
+     * @param [out]  out_statistics   Snapshot of the counters.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result getReceiveStatistics(std::uint_fast8_t interface_index, ReceiveStatistics& out_statistics) const;
+
+    /**
+     * Configure the gateway direction that forwards the frames received by an interface to its peer (1st and 2nd
+     * interfaces are peers). A received frame matching a rule, checked in order, is forwarded from the reception
+     * path: straight into a free transmission message buffer of the peer if its transmission queue is empty, with
+     * no byte swapping or application copy, or else through the peer's queue. Forwarded frames aren't delivered
+     * locally, the reception filters must accept them. The latency of the frames forwarded straight into a message
+     * buffer is measured from their reception timestamp to the completion of their transmission.
+     * @param [in]  interface_index  The index of the ingress interface.
+     * @param [in]  rules            The forwarding rules, nullptr for none.
+     * @param [in]  rules_length     The number of rules, up to 8, 0 disables the direction.
+     * @return libuavcan::Result::Success     if the rules were applied.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or has no peer, or if there are too
+     *                                        many rules.
+     */
+    Result setGatewayRules(std::uint_fast8_t interface_index, const ForwardRule* rules, std::size_t rules_length);
+
+    /**
+     * Get the counters of the gateway direction of the frames received by an interface.
+     * @param [in]   interface_index  The index of the ingress interface.
+     * @param [out]  out_statistics   Snapshot of the counters.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound.
+     */
+    Result getGatewayStatistics(std::uint_fast8_t interface_index, GatewayStatistics& out_statistics) const;
+
+    /**
+     * Set the transmission rate limits of an interface, replacing the previous ones. A frame written through
+     * write() or writeBalanced() is charged to the first limit it matches, and refused if the limit's bucket doesn't
+     * hold enough bytes, as if the transmission queue was full, so it can be retried once the bucket refills.
+     * Frames matching no limit, forwarded by the gateway or published by the scheduler aren't limited. An
+     * interface without limits, the default, doesn't check any.
+     * @param [in]  interface_index  The index of the interface to limit, starts at 1.
+     * @param [in]  limits           The limits, checked in order, their buckets start full.
+     * @param [in]  limits_length    The number of limits, 0 for removing them.
+     * @return libuavcan::Result::Success     if the limits were set.
+     * @return libuavcan::Result::BadArgument if interface_index or limits_length are out of bound, or if a limit has
+     *                                        no rate or a burst too small for a 64-byte frame.
+     */
+    Result setRateLimits(std::uint_fast8_t interface_index, const RateLimit* limits, std::size_t limits_length);
+
+    /**
+     * Get the counters of a transmission rate limit.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  limit_index      The position of the limit in the array given to setRateLimits().
+     * @param [out] out_statistics   The counters of the limit.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index or limit_index are out of bound.
+     */
+    Result getRateLimitStatistics(std::uint_fast8_t    interface_index,
+                                  std::size_t          limit_index,
+                                  RateLimitStatistics& out_statistics) const;
+
+    /**
+     * Enable the protection against a babbling node or an interrupt storm on the reception side of an interface.
+     * The frames received by each filter are counted by the ISR over fixed windows, when a filter receives more than
+     * @p max_frames in a window, the interrupts of its message buffers are masked in IMASK1 and unmasked by the
+     * scheduler of LPIT channel 3 once @p backoff elapses. The frames arriving meanwhile overwrite each other in the
+     * masked message buffers, and the ones still held at the unmasking are discarded since their timestamps can't be
+     * resolved past a period of the FlexCAN timer, all are accounted as overruns. Only interrupt driven reception is
+     * monitored, the polling mode and the RX FIFO of classic instances aren't. The counters restart whenever the
+     * filters are set.
+     * @param [in]  interface_index  The index of the interface to protect, starts at 1.
+     * @param [in]  max_frames       Frames a filter may receive per window, 0 for disabling the protection.
+     * @param [in]  window           Length of the counting windows.
+     * @param [in]  backoff          Time the message buffers of a filter stay masked.
+     * @return libuavcan::Result::Success     if the protection was set.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound, or the window or back-off aren't
+     *                                        positive while enabling it.
+     */
+    Result setStormProtection(std::uint_fast8_t   interface_index,
+                              std::uint32_t       max_frames,
+                              duration::Monotonic window,
+                              duration::Monotonic backoff);
+
+    /**
+     * Get the counters of the reception storm protection of a filter.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  filter_index     The position of the filter in the configuration of the interface.
+     * @param [out] out_statistics   The counters of the filter.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if interface_index or filter_index are out of bound.
+     */
+    Result getStormStatistics(std::uint_fast8_t interface_index,
+                              std::size_t       filter_index,
+                              StormStatistics&  out_statistics) const;
+
+    /**
+     * Set the runtime tuning of an interface's filters, which restarts its epoch. The tuning only narrows down the
+     * filters set by startInterfaceGroup() or reconfigureFilters(), which it goes back to when relearning, and never
+     * changes their number nor depth. Disabling it keeps the filters applied so far. Classic instances can't be tuned.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  tuning           The settings of the tuning.
+     * @return libuavcan::Result::Success     if the tuning was set.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or is a classic instance, if the epoch
+     *                                        is negative, reject_percent is over 100 or stable_epochs is 0.
+     */
+    Result setFilterTuning(std::uint_fast8_t interface_index, const FilterTuning& tuning);
+
+    /**
+     * Report a received frame as rejected by the application, counted against the first filter of its interface
+     * that accepts its CAN ID.
+     * @param [in]  interface_index  The index of the interface the frame was read from, starts at 1.
+     * @param [in]  frame            The rejected frame.
+     * @return libuavcan::Result::Success     if the frame was counted.
+     * @return libuavcan::Result::NotFound    if no filter of the interface accepts the frame.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or the tuning is disabled.
+     */
+    Result reportRejected(std::uint_fast8_t interface_index, const FrameType& frame);
+
+    /**
+     * Close the epoch of an interface's filter tuning once it elapsed, to be called periodically from the
+     * application's context. A new proposal is made for every filter, and with the tuning applying them, the filters
+     * whose proposal held for the stable epochs are reconfigured, which briefly halts the interface in freeze mode.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @return libuavcan::Result::Success        if the filters were reconfigured.
+     * @return libuavcan::Result::SuccessNothing if the epoch didn't elapse or the filters were kept.
+     * @return libuavcan::Result::BadArgument    if interface_index is out of bound or the tuning is disabled.
+     * @return libuavcan::Result::Failure        if a timeout ocurred while entering or leaving freeze mode.
+     */
+    Result tuneFilters(std::uint_fast8_t interface_index);
+
+    /**
+     * Get the hit statistics of a filter as of the last closed epoch of its tuning.
+     * @param [in]  interface_index  The index of the interface, starts at 1.
+     * @param [in]  filter_index     The position of the filter in the configuration of the interface.
+     * @param [out] out_statistics   The statistics of the filter.
+     * @return libuavcan::Result::Success     if the statistics were read.
+     * @return libuavcan::Result::BadArgument if interface_index or filter_index are out of bound.
+     */
+    Result getFilterHitStatistics(std::uint_fast8_t    interface_index,
+                                  std::size_t          filter_index,
+                                  FilterHitStatistics& out_statistics) const;
+
+    /**
+     * Add a periodic publication, a pre-encoded frame published every @p period by a scheduler driven from LPIT
+     * channel 3, starting right away. A pinned publication owns a transmission message buffer, at each period only
+     * its payload words patched since the previous one and its Control and Status word are rewritten, its ID word is
+     * written once. One of the two transmission message buffers of an interface can be pinned, the other one stays
+     * for the transmission queue, through which the unpinned publications are inserted like written frames.
+     * @param [in]  interface_index  The index of the interface to publish through, starts at 1.
+     * @param [in]  frame            The frame template, its ID and data length are kept for the publication's life.
+     * @param [in]  period           Time between publications.
+     * @param [in]  pinned           True for dedicating a transmission message buffer to the publication.
+     * @param [out] out_handle       Handle of the publication for patching or removing it.
+     * @return libuavcan::Result::Success     if the publication was added.
+     * @return libuavcan::Result::BufferFull  if all the publications are taken or, for a pinned one, no idle message
+     *                                        buffer can be spared right now.
+     * @return libuavcan::Result::BadArgument if interface_index or period are out of bound, or if the frame is longer
+     *                                        than 8 bytes for an interface in classic CAN mode.
+     */
+    Result addPublication(std::uint_fast8_t   interface_index,
+                          const FrameType&    frame,
+                          duration::Monotonic period,
+                          bool                pinned,
+                          std::uint8_t&       out_handle);
+
+    /**
+     * Patch some bytes of a publication's payload, the next period publishes them.
+     * @param [in]  handle  The handle of the publication.
+     * @param [in]  offset  Offset in bytes within the payload.
+     * @param [in]  data    The new bytes.
+     * @param [in]  length  The number of bytes, the patch must lie within the frame's data length.
+     * @return libuavcan::Result::Success     if the payload was patched.
+     * @return libuavcan::Result::BadArgument if the handle or the range are invalid.
+     */
+    Result patchPublication(std::uint8_t handle, std::size_t offset, const std::uint8_t* data, std::size_t length);
+
+    /**
+     * Remove a periodic publication, a pinned message buffer is deactivated and returned to the transmission queue.
+     * @param [in]  handle  The handle of the publication.
+     * @return libuavcan::Result::Success     if the publication was removed.
+     * @return libuavcan::Result::BadArgument if the handle is invalid.
+     */
+    Result removePublication(std::uint8_t handle);
+
+    /**
+     * Get the counters of a periodic publication.
+     * @param [in]  handle          The handle of the publication.
+     * @param [out] out_statistics  The counters of the publication.
+     * @return libuavcan::Result::Success     if the counters were read.
+     * @return libuavcan::Result::BadArgument if the handle is invalid.
+     */
+    Result getPublicationStatistics(std::uint8_t handle, PublicationStatistics& out_statistics) const;
+
+    /**
+     * Schedule a frame to enter arbitration at a given time. It is preloaded into a free transmission message buffer
+     * left inactive 200 microseconds before @p target, then the scheduler of LPIT channel 3 activates it at
+     * @p target by only writing its Control and Status word. The frame bypasses the transmission queue and its
+     * lanes, and isn't preempted. A frame that finds no free message buffer by its target is missed.
+     * @param [in]  interface_index  The index of the interface to transmit through, starts at 1.
+     * @param [in]  frame            The frame to transmit.
+     * @param [in]  target           Activation time, in the time base of the received frames' timestamps.
+     * @param [out] out_handle       Handle of the calendar entry for reading its report or cancelling it.
+     * @return libuavcan::Result::Success     if the frame was scheduled.
+     * @return libuavcan::Result::BufferFull  if the calendar of the interface is full.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound, or if the frame is longer than 8
+     *                                        bytes for an interface in classic CAN mode.
+     */
+    Result writeAt(std::uint_fast8_t          interface_index,
+                   const FrameType&           frame,
+                   libuavcan::time::Monotonic target,
+                   std::uint8_t&              out_handle);
+
+    /**
+     * Read the outcome of a time-triggered frame, its calendar entry is freed once it is transmitted or missed.
+     * @param [in]  interface_index  The index of the interface of the frame, starts at 1.
+     * @param [in]  handle           The handle returned by writeAt().
+     * @param [out] out_report       The target and the timestamp of the transmission, compare them for the error.
+     * @return libuavcan::Result::Success        if the frame was transmitted.
+     * @return libuavcan::Result::SuccessNothing if the frame is still pending.
+     * @return libuavcan::Result::Failure        if the frame was missed for the lack of a free message buffer.
+     * @return libuavcan::Result::BadArgument    if interface_index or handle are invalid.
+     */
+    Result readTimedReport(std::uint_fast8_t interface_index, std::uint8_t handle, TimedReport& out_report);
+
+    /**
+     * Cancel a time-triggered frame that hasn't been activated yet.
+     * @param [in]  interface_index  The index of the interface of the frame, starts at 1.
+     * @param [in]  handle           The handle returned by writeAt().
+     * @return libuavcan::Result::Success     if the frame was cancelled and its calendar entry freed.
+     * @return libuavcan::Result::Failure     if the frame was already activated, its report stays available.
+     * @return libuavcan::Result::BadArgument if interface_index or handle are invalid.
+     */
+    Result cancelWriteAt(std::uint_fast8_t interface_index, std::uint8_t handle);
+
     /** 
      * Reconfigure reception filters for dynamic subscription of nodes, all the previous filter configurations are
      * cleared.
@@ -94,15 +878,63 @@ public:
     virtual Result reconfigureFilters(const typename FrameType::Filter* filter_config,
                                       std::size_t                       filter_config_length) override;
 
+    /**
+     * Reconfigure reception filters giving each filter a depth of consecutive message buffers. FlexCAN spills a burst
+     * of frames matching a filter into the next free message buffer of its group, which then acts as a hardware FIFO
+     * of that depth, frames are still delivered in arrival order. All the previous filter configurations are cleared.
+     * @param [in]  filter_config         The filtering to apply equally to all members of the group.
+     * @param [in]  filter_depth          Number of message buffers of each filter, nullptr for one each. Every depth
+     *                                    must be at least 1 and their sum at most 5.
+     * @param [in]  filter_config_length  The length of the @p filter_config and @p filter_depth arguments.
+     * @return libuavcan::Result::Success     if the group's receive filtering was successfully reconfigured.
+     * @return libuavcan::Result::Failure     if a register didn't get configured as desired.
+     * @return libuavcan::Result::BadArgument if the filters don't fit in the reception message buffers.
+     */
+    Result reconfigureFilters(const typename FrameType::Filter* filter_config,
+                              const std::uint8_t*               filter_depth,
+                              std::size_t                       filter_config_length);
+
+    /**
+     * Reconfigure the reception filters of a single interface, the other members of the group keep their filters and
+     * aren't halted. All the previous filter configurations of the interface are cleared.
+     * @param [in]  interface_index       The index of the interface whose filters are replaced, starts at 1.
+     * @param [in]  filter_config         The filtering to apply to the interface.
+     * @param [in]  filter_depth          Number of message buffers of each filter, nullptr for one each. Every depth
+     *                                    must be at least 1 and their sum at most 5.
+     * @param [in]  filter_config_length  The length of the @p filter_config and @p filter_depth arguments.
+     * @return libuavcan::Result::Success     if the interface's receive filtering was successfully reconfigured.
+     * @return libuavcan::Result::Failure     if a register didn't get configured as desired.
+     * @return libuavcan::Result::BadArgument if interface_index is out of bound or the filters don't fit in the
+     *                                        reception message buffers.
+     */
+    Result reconfigureFilters(std::uint_fast8_t                 interface_index,
+                              const typename FrameType::Filter* filter_config,
+                              const std::uint8_t*               filter_depth,
+                              std::size_t                       filter_config_length);
+
     /** 
      * Block with timeout for available Message buffers.
      * @param [in]  timeout                 The amount of time to wait for and available message buffer.
-     * @param [in]  ignore_write_available  If set to true, will check availability only for RX MB's
+     * @param [in]  ignore_write_available  If set to true, will check availability only for RX MB's, otherwise
+     *                                      an interface is also ready when its transmission queue isn't full
      * @return libuavcan::Result::SuccessTimeout if timeout occurred and no required MB's became available.
      *         libuavcan::Result::Success if an interface is ready for read, and if
      *         @p ignore_write_available is false, or write.
      */
     virtual Result select(libuavcan::duration::Monotonic timeout, bool ignore_write_available) override;
+
+    /**
+     * Block with timeout until any of the interfaces and directions of a mask is ready, and tell which ones are.
+     * The readiness is kept as a bit mask by the ISR's, read() and write(), so each check reads a single word
+     * instead of probing every interface's queues, plus the RX MB's of the interfaces in polling mode and the eDMA
+     * ring of the classic instances, whose frames don't go through the ISR.
+     * @param [in]  timeout    The amount of time to wait for an interface to be ready.
+     * @param [in]  mask       The readiness bits waited for, built with readyRX() and readyTX().
+     * @param [out] out_ready  The bits of @p mask that are ready, 0 on timeout.
+     * @return libuavcan::Result::SuccessTimeout if timeout occurred and none of the bits became ready.
+     *         libuavcan::Result::Success if at least one of the bits is ready.
+     */
+    Result select(libuavcan::duration::Monotonic timeout, std::uint32_t mask, std::uint32_t& out_ready);
 };
 
 /**
@@ -119,6 +951,36 @@ private:
     InterfaceGroupType InterfaceGroupObj_;
 
 public:
+    /**
+     * Default bit rates of the nominal (arbitration) and data phases, in bit/s.
+     */
+    static constexpr std::uint32_t DefaultNominalBitrate = 1000000u;
+    static constexpr std::uint32_t DefaultDataBitrate    = 4000000u;
+
+    /**
+     * Configuration of a single FlexCAN instance, for starting the group with different filters, message buffer
+     * layouts or bit rates on each interface.
+     */
+    struct InterfaceConfig
+    {
+        /* The filtering to apply to the instance */
+        const typename InterfaceGroupType::FrameType::Filter* filter_config;
+
+        /* Number of reception message buffers of each filter, nullptr for one each */
+        const std::uint8_t* filter_depth;
+
+        /* The length of filter_config and filter_depth */
+        std::size_t filter_config_length;
+
+        /* Nominal phase bit rate, the 80Mhz clock must divide into 80 time quantas per bit, e.g. 1, 0.5 or
+           0.25 Mbit/s */
+        std::uint32_t nominal_bitrate;
+
+        /* Data phase bit rate, no slower than the nominal one, the 80Mhz clock must divide into 20 time quantas per
+           bit, e.g. 4, 2 or 1 Mbit/s. Ignored by the classic CAN instances */
+        std::uint32_t data_bitrate;
+    };
+
     /** 
      * Initialize the peripherals needed for the driver in the target MCU, also configures the
      * core clock sources to the Normal RUN profile.
@@ -135,6 +997,22 @@ public:
                                        std::size_t                                           filter_config_length,
                                        InterfaceGroupPtrType&                                out_group) override;
 
+    /**
+     * Initialize the peripherals like the method above, configuring each FlexCAN instance from its own entry of
+     * @p configs, in the same order as the interface indices.
+     * @param [in]   configs         The configuration of each FlexCAN instance.
+     * @param [in]   configs_length  The length of the @p configs argument, must equal the number of instances.
+     * @param [out]  out_group       A pointer to set to the started group. This will be nullptr if the start
+     * method fails.
+     * @return libuavcan::Result::Success     if the group was successfully started and a valid pointer was returned.
+     * @return libuavcan::Result::Failure     if the initialization fails at some point.
+     * @return libuavcan::Result::BadArgument if configs_length, a filter layout or a bit rate are invalid, nothing
+     *                                        gets initialized then.
+     */
+    Result startInterfaceGroup(const InterfaceConfig* configs,
+                               std::size_t            configs_length,
+                               InterfaceGroupPtrType& out_group);
+
     /**
      * Release and deinitialize the peripherals needed for the current driver, disables all the FlexCAN
      * instances available, waiting for any pending transmission or reception to finish before. Also
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/**
+ * @file
+ * Header file of the eDMA transfer control descriptors programmed by the S32K driver for its payload copies, kept
+ * apart from the driver so the host register model of the eDMA engine runs the very same descriptors.
+ */
+
+#ifndef EDMA_HPP_INCLUDED
+#define EDMA_HPP_INCLUDED
+
+#include <cstdint>
+#include <type_traits>
+
+/* Memory map of the target S32K14x, for the eDMA register layout and field macros */
+#include "S32K146.h"
+
+namespace libuavcan
+{
+namespace media
+{
+namespace S32K
+{
+/**
+ * Transfer control descriptor (TCD) of an eDMA channel, as laid out in the eDMA register block.
+ */
+using DMA_TCD_Type = std::remove_reference<decltype(static_cast<DMA_Type*>(nullptr)->TCD[0])>::type;
+
+/**
+ * Program the descriptor of a channel for copying a payload of 32-bit words, completed by a single software start
+ * (TCD_CSR[START]) with a major loop interrupt, after which the channel's request is cleared. Requires minor loop
+ * mapping (CR[EMLM]). A plain copy is a single minor loop of the whole payload. A byte swapped copy runs a minor loop
+ * per word with 8-bit accesses, copying each word's bytes backwards while the destination minor loop offset skips to
+ * the next word; each minor loop links to its own channel, since a software start only runs one minor loop.
+ * @param [out] TCD          The descriptor of the channel.
+ * @param [in]  channel      The eDMA channel of the descriptor.
+ * @param [in]  source       Bus address of the first payload word to copy.
+ * @param [in]  destination  Bus address where the payload is copied to.
+ * @param [in]  words        Number of 32-bit words of the payload, 1 to 16.
+ * @param [in]  byte_swap    Reverse the byte order of each word.
+ */
+inline void edma_ProgramCopy(DMA_TCD_Type& TCD,
+                             std::uint8_t  channel,
+                             std::uint32_t source,
+                             std::uint32_t destination,
+                             std::uint8_t  words,
+                             bool          byte_swap)
+{
+    TCD.SADDR = source;
+    TCD.SLAST = 0;
+    if (byte_swap)
+    {
+        TCD.DADDR           = destination + 3u;                               /* Last byte of the first word */
+        TCD.SOFF            = 1u;                                             /* Next source byte */
+        TCD.DOFF            = static_cast<std::uint16_t>(-1);                 /* Previous destination byte */
+        TCD.ATTR            = DMA_TCD_ATTR_SSIZE(0) | DMA_TCD_ATTR_DSIZE(0); /* 8-bit accesses */
+        TCD.NBYTES.MLOFFYES = DMA_TCD_NBYTES_MLOFFYES_DMLOE(1) | DMA_TCD_NBYTES_MLOFFYES_MLOFF(8) |
+                              DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
+        TCD.CITER.ELINKYES  = DMA_TCD_CITER_ELINKYES_ELINK_MASK | DMA_TCD_CITER_ELINKYES_LINKCH(channel) |
+                              DMA_TCD_CITER_ELINKYES_CITER_LE(words); /* Each minor loop restarts the channel */
+        TCD.BITER.ELINKYES  = DMA_TCD_BITER_ELINKYES_ELINK_MASK | DMA_TCD_BITER_ELINKYES_LINKCH(channel) |
+                              DMA_TCD_BITER_ELINKYES_BITER(words);
+    }
+    else
+    {
+        TCD.DADDR           = destination;
+        TCD.SOFF            = 4u;                                             /* Next source word */
+        TCD.DOFF            = 4u;                                             /* Next destination word */
+        TCD.ATTR            = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2); /* 32-bit accesses */
+        TCD.NBYTES.MLOFFNO  = DMA_TCD_NBYTES_MLOFFNO_NBYTES(4u * words);     /* The whole payload at once */
+        TCD.CITER.ELINKNO   = DMA_TCD_CITER_ELINKNO_CITER(1);
+        TCD.BITER.ELINKNO   = DMA_TCD_BITER_ELINKNO_BITER(1);
+    }
+    TCD.DLASTSGA = 0;
+    TCD.CSR      = DMA_TCD_CSR_INTMAJOR_MASK | DMA_TCD_CSR_DREQ_MASK; /* Interrupt at completion, run once */
+}
+
+}  // END namespace S32K
+}  // END namespace media
+}  // END namespace libuavcan
+
+#endif  // EDMA_HPP_INCLUDED
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/**
+ * @file
+ * Header file of the bulk data streaming engine, which pipelines a blob (logs, calibration tables, firmware images)
+ * as a window of 64-byte CAN-FD frames with selective acknowledgements, on top of the media layer.
+ */
+
+#ifndef STREAM_HPP_INCLUDED
+#define STREAM_HPP_INCLUDED
+
+#include "libuavcan/media/can.hpp"
+#include "libuavcan/media/interfaces.hpp"
+
+namespace libuavcan
+{
+namespace media
+{
+namespace S32K
+{
+/**
+ * Streaming engine of a single blob between two nodes, one instance sends it through send() and the other receives
+ * it through listen(), both with the same pair of CAN ID's. Every data frame carries 60 bytes of the blob and its
+ * sequence number, so the sender keeps a whole window of them queued for transmission, which keeps both transmission
+ * message buffers busy, instead of waiting for a round trip per frame. The receiver writes each chunk straight into
+ * its destination through a sink callback, at the chunk's offset, and acknowledges the window with the next expected
+ * sequence number and a bitmap of the frames received past it, so the sender only retransmits the missing ones.
+ *
+ * The engine doesn't touch any peripheral, it only uses the abstract interface group and the times passed by the
+ * caller, so it runs the same between two nodes of a host loopback group.
+ */
+class BulkStream
+{
+public:
+    /**
+     * Frame type of the streams, 64-byte CAN-FD frames.
+     */
+    using FrameType = media::CAN::Frame<media::CAN::TypeFD::MaxFrameSizeBytes>;
+
+    /**
+     * Interface group type the streams are transmitted through.
+     */
+    using GroupType = media::InterfaceGroup<FrameType>;
+
+    /**
+     * Bytes of the blob carried by each data frame, after its 4-byte header.
+     */
+    static constexpr std::size_t ChunkBytes = 60u;
+
+    /**
+     * Maximum number of data frames in flight, not yet acknowledged.
+     */
+    static constexpr std::uint32_t Window = 32u;
+
+    /**
+     * Callback through which the receiver writes the chunks of the blob into their destination, chunks may arrive
+     * out of order but each is written exactly once.
+     * @param [in]  context  The context pointer given to listen().
+     * @param [in]  offset   Offset in bytes of the chunk within the blob.
+     * @param [in]  data     The chunk, only valid for the duration of the call.
+     * @param [in]  length   The length in bytes of the chunk.
+     */
+    using Sink = void (*)(void* context, std::uint32_t offset, const std::uint8_t* data, std::size_t length);
+
+    /**
+     * Counters of a stream, for both the sender and the receiver.
+     */
+    struct StreamStatistics
+    {
+        std::uint32_t bytes;         /**< Bytes of the blob acknowledged (sender) or written to the sink (receiver). */
+        std::uint32_t frames;        /**< Data frames transmitted (sender) or received (receiver). */
+        std::uint32_t retransmitted; /**< Data frames transmitted again (sender) or received again (receiver). */
+        std::uint32_t acks;          /**< Acknowledgement frames received (sender) or transmitted (receiver). */
+        std::uint64_t elapsed;       /**< Microseconds from the first to the last frame of the stream. */
+    };
+
+    /**
+     * Create a stream bound to an interface of a started group.
+     * @param [in]  group            The group to transmit through.
+     * @param [in]  interface_index  The index of the interface in the group, starts at 1.
+     * @param [in]  data_id          CAN ID of the data frames, transmitted by the sender.
+     * @param [in]  ack_id           CAN ID of the acknowledgement frames, transmitted by the receiver.
+     */
+    BulkStream(GroupType& group, std::uint_fast8_t interface_index, std::uint32_t data_id, std::uint32_t ack_id);
+
+    /**
+     * Start sending a blob, which must stay valid and unchanged until the stream is complete or failed.
+     * @param [in]  blob         The data to stream.
+     * @param [in]  blob_length  Length in bytes of @p blob, at least 1.
+     * @param [in]  now          The current time.
+     * @return libuavcan::Result::Success     if the stream was started.
+     * @return libuavcan::Result::BadArgument if the blob is empty.
+     */
+    Result send(const std::uint8_t* blob, std::uint32_t blob_length, libuavcan::time::Monotonic now);
+
+    /**
+     * Start receiving a blob, any previous stream is dropped.
+     * @param [in]  sink     Callback that writes the received chunks into their destination.
+     * @param [in]  context  Pointer passed back to @p sink.
+     * @return libuavcan::Result::Success     if the receiver is waiting for the first frame.
+     * @return libuavcan::Result::BadArgument if @p sink is nullptr.
+     */
+    Result listen(Sink sink, void* context);
+
+    /**
+     * Hand a frame received from the stream's interface to the engine, frames of other CAN ID's are ignored.
+     * @param [in]  frame  The received frame.
+     * @param [in]  now    The current time.
+     * @return libuavcan::Result::Success        if the frame belonged to the stream.
+     * @return libuavcan::Result::SuccessNothing if the frame wasn't for this stream.
+     */
+    Result accept(const FrameType& frame, libuavcan::time::Monotonic now);
+
+    /**
+     * Keep the stream moving, to be called periodically or whenever the interface becomes ready for writing. The
+     * sender fills the window with new frames and retransmits the timed out or selectively unacknowledged ones,
+     * the receiver flushes a pending acknowledgement.
+     * @param [in]  now  The current time.
+     * @return libuavcan::Result::Success        if the stream is still in progress.
+     * @return libuavcan::Result::SuccessNothing if the stream is complete or there's none.
+     * @return libuavcan::Result::Failure        if the sender exhausted its retransmissions without progress.
+     */
+    Result poll(libuavcan::time::Monotonic now);
+
+    /**
+     * Set the time without acknowledgement after which the sender retransmits a frame, 10 milliseconds by default.
+     * @param [in]  timeout      The retransmission timeout.
+     * @param [in]  max_retries  Consecutive timeouts of the oldest frame after which the stream fails.
+     * @return libuavcan::Result::Success     if the timeout was set.
+     * @return libuavcan::Result::BadArgument if the timeout isn't positive.
+     */
+    Result setRetransmitTimeout(libuavcan::duration::Monotonic timeout, std::uint8_t max_retries);
+
+    /**
+     * Get the counters of the current or last stream.
+     * @param [out] out_statistics  The counters of the stream.
+     * @return libuavcan::Result::Success     if the counters were read.
+     */
+    Result getStatistics(StreamStatistics& out_statistics) const;
+
+    /**
+     * Sustained throughput of the current or last stream in bytes per second.
+     * @return Bytes of the blob per second over the elapsed time, 0 before the second frame.
+     */
+    std::uint32_t getThroughput() const;
+
+    /**
+     * Sustained throughput of the current or last stream in MB/s (10^6 bytes per second), as fixed point with three
+     * decimals for the integer arithmetic of the target: 352 stands for 0.352 MB/s.
+     * @return Thousandths of MB/s over the elapsed time, 0 before the second frame.
+     */
+    std::uint32_t getThroughputMBps() const;
+
+private:
+    /* Roles of the stream */
+    enum class Role : std::uint8_t
+    {
+        Idle,
+        Sender,
+        Receiver
+    };
+
+    /* Transmit a frame through the interface, returns false if its transmission queue is full */
+    bool transmit_Frame(std::uint32_t id, const std::uint8_t* payload, std::uint_fast8_t length);
+
+    /* Transmit the data frame of an absolute sequence number and record its transmission time */
+    bool transmit_Chunk(std::uint32_t seq, libuavcan::time::Monotonic now);
+
+    /* Transmit the acknowledgement of the receiver's window */
+    bool transmit_Ack();
+
+    /* Sender side handling of an acknowledgement frame */
+    void accept_Ack(const FrameType& frame, libuavcan::time::Monotonic now);
+
+    /* Receiver side handling of a data frame */
+    void accept_Chunk(const FrameType& frame, libuavcan::time::Monotonic now);
+
+    /* Record a frame of the stream for the elapsed time */
+    void stamp(libuavcan::time::Monotonic now);
+
+    GroupType&        group_;
+    std::uint_fast8_t interface_index_;
+    std::uint32_t     data_id_;
+    std::uint32_t     ack_id_;
+    Role              role_;
+
+    /* Sender state, the window starts at the oldest unacknowledged sequence number */
+    const std::uint8_t*            blob_;
+    std::uint32_t                  blob_length_;
+    std::uint32_t                  chunk_count_;
+    std::uint32_t                  base_;
+    std::uint32_t                  next_;
+    std::uint32_t                  acked_;      /* Bit k set if base_ + k was selectively acknowledged */
+    std::uint32_t                  fast_done_;  /* Bit k set if base_ + k was retransmitted by a gap */
+    std::uint32_t                  highest_;    /* Highest sequence number acknowledged plus one */
+    std::uint8_t                   retries_;
+    std::uint8_t                   max_retries_;
+    libuavcan::duration::Monotonic retransmit_timeout_;
+    libuavcan::time::Monotonic     sent_[Window]; /* Last transmission of each window slot */
+
+    /* Receiver state, the window starts at the next expected sequence number */
+    Sink          sink_;
+    void*         context_;
+    std::uint32_t expected_;
+    std::uint32_t received_;     /* Bit k set if expected_ + 1 + k was received */
+    std::uint32_t last_seq_;     /* Sequence number of the last chunk plus one, 0 until received */
+    std::uint8_t  unacked_;      /* Chunks received since the last acknowledgement */
+    bool          ack_pending_;  /* An acknowledgement couldn't be queued yet */
+
+    /* Statistics of the stream */
+    StreamStatistics           statistics_;
+    libuavcan::time::Monotonic first_;
+    bool                       started_;
+};
+
+}  // END namespace S32K
+}  // END namespace media
+}  // END namespace libuavcan
+
+#endif  // STREAM_HPP_INCLUDED
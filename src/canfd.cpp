@@ -18,12 +18,46 @@
 #    define UAVCAN_NODE_BOARD_USED 1
 #endif
 
+/*
+ * Macro for enabling the deferred reception processing in a PendSV bottom half, which also installs the driver's
+ * PendSV_Handler, the instances using it are selected in the Deferred_RX table. Keep it at 0 when PendSV is used
+ * by an RTOS.
+ */
+#ifndef UAVCAN_DEFERRED_RX
+#    define UAVCAN_DEFERRED_RX 0
+#endif
+
+/*
+ * Macro for offloading the payload copies from memory into the transmission message buffers to software triggered
+ * eDMA channels, which also installs the driver's handlers of those channels' interrupts. The reception copies stay
+ * on the CPU: a RX MB must stay locked during its copy, and any read of another MB's Control and Status word or of
+ * the timer in between, from any context, would unlock it while eDMA copies it.
+ */
+#ifndef UAVCAN_DMA_PAYLOAD
+#    define UAVCAN_DMA_PAYLOAD 0
+#endif
+
+/*
+ * Macro for enabling the classic CAN mode, which also installs the driver's handlers of the interrupts of the eDMA
+ * reception channels, the instances using it are selected in the Classic_CAN table. Keep it at 0 when those
+ * channels are used by the application.
+ */
+#ifndef UAVCAN_CLASSIC_CAN
+#    define UAVCAN_CLASSIC_CAN 0
+#endif
+
 /* S32K driver header file */
 #include "libuavcan/media/S32K/canfd.hpp"
 
+/* Descriptors of the eDMA payload copies */
+#include "libuavcan/media/S32K/edma.hpp"
+
 /* STL queue for the intermediate ISR buffer */
 #include <deque>
 
+/* STL atomics for the reference counts of the shared frames, the submission ring and the bus load counters */
+#include <atomic>
+
 /* libuavcan core header file for static pool allocator */
 #include "libuavcan/platform/memory.hpp"
 
@@ -71,6 +105,9 @@ constexpr static std::size_t Frame_Capacity = 40u;
 /* Number of filters supported by a single FlexCAN instance */
 constexpr static std::uint8_t Filter_Count = 5u;
 
+/* Number of message buffers used for reception, the 2nd-6th, each filter takes one or more of them */
+constexpr static std::uint8_t RX_MB_Count = 5u;
+
 /* Lookup table for NVIC IRQ numbers for each FlexCAN instance */
 constexpr static std::uint32_t FlexCAN_NVIC_Indices[][2u] = {{2u, 0x20000}, {2u, 0x1000000}, {2u, 0x80000000}};
 
@@ -89,6 +126,16 @@ constexpr static std::uint8_t MB_Data_Offset = 2u;
 /* Number of cycles to wait for the timed polls, corresponding to a timeout of 1/(80Mhz) * 2^24 = 0.2 seconds approx */
 constexpr static std::uint32_t cycles_timeout = 0xFFFFFF;
 
+/* Clock of the FlexCAN protocol engines (SYS_CLK), and the time quantas per bit of the nominal and data phase segment
+ * configurations, their bit rates are set by the prescalers alone so that the sample points stay put */
+constexpr static std::uint32_t FlexCAN_Clock_Hz     = 80000000u;
+constexpr static std::uint32_t Nominal_Bit_Quantas  = 80u;
+constexpr static std::uint32_t Data_Bit_Quantas     = 20u;
+constexpr static std::uint32_t Max_Prescaler_Factor = 1024u;
+
+/* Largest data phase prescaler division factor for which the transceiver delay compensation is still valid */
+constexpr static std::uint32_t Max_TDC_Prescaler_Factor = 2u;
+
 /* Frame's reception FIFO as a dequeue with libuavcan's static memory pool, one for each available interface */
 static std::deque<InterfaceGroup::FrameType,
                   platform::memory::PoolAllocator<Frame_Capacity, sizeof(InterfaceGroup::FrameType)>>
@@ -100,356 +147,4522 @@ volatile static std::uint32_t g_data_ISR_word[InterfaceGroup::FrameType::MTUByte
 /* Counter for the number of discarded messages due to the RX FIFO being full */
 volatile static std::uint32_t g_discarded_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
 
+/* Counter for the number of queued messages evicted by higher priority ones under EvictLowestPriority */
+volatile static std::uint32_t g_evicted_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Counter for the number of discarded messages due to their class' reserved headroom under ReservePerClass */
+volatile static std::uint32_t g_reserved_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Counter for the number of queued messages discarded by read() for exceeding the maximum frame age */
+volatile static std::uint32_t g_expired_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Counter for the number of received frames that overwrote a previous one not yet read (OVERRUN code) */
+volatile static std::uint32_t g_overrun_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Counter for the number of flagged RX MB's discarded for not holding a complete frame when locked */
+volatile static std::uint32_t g_torn_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Admission policy of each interface's RX FIFO */
+static InterfaceGroup::AdmissionPolicy g_admission_policy[CANFD_Count];
+
+/* Maximum age in microseconds of the frames returned by read() from each interface's RX FIFO, 0 disables aging */
+static std::uint64_t g_max_frame_age[CANFD_Count];
+
 /*
- * Enumeration for converting from a bit number to an index, used for some registers where a bit flag for a nth
- * message buffer is represented as a bit left shifted nth times. e.g. 2nd MB is 0b100 = 4 = (1 << 2)
+ * Tunable number of slots of the RX FIFO that must remain free for a frame of each UAVCAN priority class to be
+ * admitted under the ReservePerClass policy, indexed by priority (0 is exceptional, 7 is optional).
  */
-enum MB_bit_to_index : std::uint8_t
+constexpr static std::uint8_t Priority_Class_Headroom[] = {0u, 1u, 2u, 4u, 6u, 8u, 10u, 12u};
+
+/* Number of message buffers used for transmission, the 0th and 1st */
+constexpr static std::uint8_t TX_MB_Count = 2u;
+
+/* Bit masks of the transmission (0b0000011) and reception (0b1111100) message buffers in IMASK1 and IFLAG1 */
+constexpr static std::uint32_t TX_MB_Mask = 0x03u;
+constexpr static std::uint32_t RX_MB_Mask = 0x7Cu;
+
+/* Polling mode enabled for each interface, its RX MB's are drained by read() instead of the ISR */
+static bool g_rx_polling[CANFD_Count];
+
+/*
+ * Tunable split of the reception processing of each FlexCAN instance, requires UAVCAN_DEFERRED_RX. When set, the ISR
+ * only captures the raw contents of the received MB's and pends PendSV, whose low priority handler resolves the
+ * timestamps, dispatches and queues every captured frame in a batch. For the frames of ports registered with a
+ * callback, the PendSV handler is the context the callback is invoked from.
+ */
+constexpr static bool Deferred_RX[] = {UAVCAN_DEFERRED_RX, UAVCAN_DEFERRED_RX, UAVCAN_DEFERRED_RX};
+
+/* Tunable capacity of the raw frame ring of each deferred instance, each slot adds 72 bytes of required .bss memory */
+constexpr static std::size_t Raw_Frame_Capacity = 8u;
+
+/* Lowest priority for the PendSV exception, only the upper 4 bits are implemented in the S32K1 */
+constexpr static std::uint8_t PendSV_Priority = 0xF0u;
+
+/* Raw contents of a received MB as captured by the ISR of a deferred instance */
+struct RawFrame
+{
+    std::uint32_t CS;                                                /* Control and Status word */
+    std::uint32_t id;                                                /* ID word */
+    std::uint32_t payload[InterfaceGroup::FrameType::MTUBytes / 4u]; /* Payload words in FlexCAN's byte order */
+};
+
+/* Single producer (ISR) single consumer (PendSV) ring of raw frames of a deferred instance */
+struct RawFrameRing
 {
-    MessageBuffer0 = 0x1,  /* Number representing the bit for the zeroth MB (1 << 2) */
-    MessageBuffer1 = 0x2,  /* Number for the bit of the first  MB (1 << 3) */
-    MessageBuffer2 = 0x4,  /* Number for the bit of the second MB (1 << 2) */
-    MessageBuffer3 = 0x8,  /* Number for the bit of the third  MB (1 << 3) */
-    MessageBuffer4 = 0x10, /* Number for the bit of the fourth MB (1 << 4) */
-    MessageBuffer5 = 0x20, /* Number for the bit of the fifth  MB (1 << 5) */
-    MessageBuffer6 = 0x40, /* Number for the bit of the sixth  MB (1 << 6) */
+    RawFrame              frames[Raw_Frame_Capacity]; /* Storage of the ring */
+    volatile std::uint8_t head;                       /* Index of the next frame to process */
+    volatile std::uint8_t tail;                       /* Index of the next free slot */
 };
 
+/* Raw frame ring of each instance */
+static RawFrameRing g_raw_ring[CANFD_Count];
+
+/* eDMA channels of each instance draining the RX FIFO of the classic mode, and copying the transmission payloads */
+constexpr static std::uint8_t DMA_RX_Channel[] = {0u, 2u, 4u};
+constexpr static std::uint8_t DMA_TX_Channel[] = {1u, 3u, 5u};
+
+/* Tunable minimum number of payload words copied by eDMA, shorter payloads are cheaper to copy than to set up a
+ * transfer and take its completion interrupt */
+constexpr static std::uint8_t DMA_Min_Payload_Words = 4u;
+
+/* TX MB whose payload is being copied by eDMA for each instance, TX_MB_Count if none, and its Control and Status word
+ * written once the transfer completes */
+volatile static std::uint8_t  g_dma_TX_MB[CANFD_Count];
+volatile static std::uint32_t g_dma_TX_CS[CANFD_Count];
+
 /*
- * Helper function for block polling a bit flag until it is set with a timeout of 0.2 seconds using a LPIT timer,
- * the argument list and usage reassembles the classic block polling while loop, and instead of using a third
- * argument to decide if it'ss a timed block for a clear or set, the two flavors of the function are provided.
- *
- * param  flagRegister Register where the flag is located.
- * param  flagMask     Mask to AND'nd with the register for isolating the flag.
- * return Result::Success If the flag set before the timeout expiration..
- * return Result::Failure If a timeout ocurred before the desired flag set.
+ * Tunable classic CAN mode of each FlexCAN instance, requires UAVCAN_CLASSIC_CAN, for buses that only carry classic
+ * frames of up to 8 bytes. When set, the instance runs without CAN-FD and with 16-byte MB's: the received frames go
+ * through the ID filter table of the legacy RX FIFO, which absorbs bursts of 6 frames in hardware and is drained by
+ * the instance's eDMA reception channel into a ring read by read(), with a light interrupt per frame that stamps it.
+ * The transmission MB's are moved after the FIFO.
  */
-Result flagPollTimeout_Set(volatile std::uint32_t& flagRegister, std::uint32_t flag_Mask)
+constexpr static bool Classic_CAN[] = {false, false, false};
+static_assert(UAVCAN_CLASSIC_CAN || !(Classic_CAN[0] || Classic_CAN[1] || Classic_CAN[2]),
+              "Classic CAN mode requires UAVCAN_CLASSIC_CAN");
+
+/* Size in words of a MB in classic mode, 8 payload bytes and 8 for headers */
+constexpr static std::uint8_t Classic_MB_Size_Words = 4u;
+
+/* Maximum payload length in bytes of a classic frame */
+constexpr static std::uint8_t Classic_Max_Length = 8u;
+
+/* First transmission MB in classic mode, MB's 0-5 are taken by the RX FIFO and 6-7 by its ID filter table */
+constexpr static std::uint8_t Classic_TX_MB_Base = 8u;
+
+/* First word and number of elements of the RX FIFO's ID filter table, 8 elements for CTRL2[RFFN] = 0 */
+constexpr static std::uint8_t Classic_Filter_Word     = 24u;
+constexpr static std::uint8_t Classic_Filter_Elements = 8u;
+
+/* Bits of the ID filter table elements and of their masks in format A */
+constexpr static std::uint32_t Classic_Filter_RTR   = 1u << 31;
+constexpr static std::uint32_t Classic_Filter_IDE   = 1u << 30;
+constexpr static std::uint32_t Classic_Filter_Shift = 1u;
+
+/* Bit of the RX FIFO overflow in IMASK1 and IFLAG1 */
+constexpr static std::uint32_t Classic_FIFO_Overflow_Mask = 1u << 7;
+
+/* DMAMUX request source of the RX FIFO of each FlexCAN instance */
+constexpr static std::uint8_t FlexCAN_DMA_Request[] = {54u, 55u, 56u};
+
+/* Tunable frame capacity of the eDMA ring of each classic instance, must be a power of two, each frame adds 24 bytes
+ * of required .bss memory */
+constexpr static std::size_t Classic_Ring_Capacity = 32u;
+static_assert(!(Classic_Ring_Capacity & (Classic_Ring_Capacity - 1u)), "Classic ring capacity not a power of two");
+
+/* Frames a classic ring holds at most, a slot stays free ahead of the eDMA writes */
+constexpr static std::uint32_t Classic_Ring_Slack = Classic_Ring_Capacity - 1u;
+
+/* Contents of the RX FIFO's output MB as copied by eDMA, in FlexCAN's byte order */
+struct ClassicFrame
 {
-    /* Initialization of delta for timeout measurement */
-    volatile std::uint32_t delta = 0;
+    std::uint32_t CS;         /* Control and Status word */
+    std::uint32_t id;         /* ID word */
+    std::uint32_t payload[2]; /* Payload words */
+};
 
-    /* Disable LPIT channel 2 for loading */
-    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_2(1);
+/* eDMA ring of each classic instance, aligned to its size since it is addressed with the destination modulo */
+alignas(Classic_Ring_Capacity * sizeof(ClassicFrame)) volatile static ClassicFrame
+    g_classic_ring[CANFD_Count][Classic_Ring_Capacity];
 
-    /* Load LPIT with its maximum value */
-    LPIT0->TMR[2].TVAL = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK;
+/* Timestamp in microseconds of each frame of the eDMA ring of each classic instance, resolved at its reception */
+static std::uint64_t g_classic_stamp[CANFD_Count][Classic_Ring_Capacity];
 
-    /* Enable LPIT channel 2 for timeout start */
-    LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_2(1);
+/* Free running counts of the frames read from and written into the eDMA ring of each classic instance, the frame of
+ * a count lives in the slot of the count modulo the ring capacity */
+volatile static std::uint32_t g_classic_head[CANFD_Count];
+volatile static std::uint32_t g_classic_tail[CANFD_Count];
 
-    /* Start of timed block */
-    while (delta < cycles_timeout)
-    {
-        /* Check if the flag has been set */
-        if (flagRegister & flag_Mask)
-        {
-            return Result::Success;
-        }
+/*
+ * Helper functions for the MB geometry of each instance, which depends on its classic CAN mode.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  mb_index  Index of the transmission MB.
+ * return Size in words of the instance's MB's, number of its first transmission MB, and first word of a transmission
+ *        MB.
+ */
+constexpr static std::uint8_t MB_Words(std::uint8_t instance)
+{
+    return Classic_CAN[instance] ? Classic_MB_Size_Words : MB_Size_Words;
+}
 
-        /* Get current value of delta */
-        delta = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK - (LPIT0->TMR[2].CVAL);
-    }
+constexpr static std::uint8_t TX_MB_Base(std::uint8_t instance)
+{
+    return Classic_CAN[instance] ? Classic_TX_MB_Base : 0u;
+}
 
-    /* If this section is reached, means timeout ocurred and return error status is returned */
-    return Result::Failure;
+constexpr static std::uint16_t TX_MB_Word(std::uint8_t instance, std::uint8_t mb_index)
+{
+    return static_cast<std::uint16_t>((TX_MB_Base(instance) + mb_index) * MB_Words(instance));
 }
 
 /*
- * Helper function for block polling a bit flag until it is cleared with a timeout of 0.2 seconds using a LPIT timer
- *
- * param  flagRegister Register where the flag is located.
- * param  flagMask     Mask to AND'nd with the register for isolating the flag.
- * return Result::Success If the flag cleared before the timeout expiration..
- * return Result::Failure If a timeout ocurred before the desired flag cleared.
+ * Helper function for the word 0 (Control and Status) that requests the transmission of a frame from a MB
+ * Extended Data Length       (EDL) = 1 ( 0 in classic mode )
+ * Bit Rate Switch            (BRS) = 1 ( 0 in classic mode )
+ * Error State Indicator      (ESI) = 0
+ * Message Buffer Code       (CODE) = 12 ( Transmit data frame )
+ * Substitute Remote Request  (SRR) = 0
+ * ID Extended Bit            (IDE) = 1
+ * Remote Tx Request          (RTR) = 0
+ * Data Length Code           (DLC) = frame's dlc
+ * Counter Time Stamp  (TIME STAMP) = 0 ( Handled by hardware )
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  frame     The frame to transmit.
+ * return The Control and Status word.
  */
-Result flagPollTimeout_Clear(volatile std::uint32_t& flagRegister, std::uint32_t flag_Mask)
+static std::uint32_t TX_MB_CS(std::uint8_t instance, const InterfaceGroup::FrameType& frame)
 {
-    /* Initialization of delta for timeout measurement */
-    volatile std::uint32_t delta = 0;
+    const std::uint32_t dlc = static_cast<std::underlying_type<libuavcan::media::CAN::FrameDLC>::type>(frame.getDLC());
 
-    /* Disable LPIT channel 2 for loading */
-    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_2(1);
+    return CAN_RAMn_DATA_BYTE_1(0x20) | CAN_WMBn_CS_DLC(dlc) |
+           CAN_RAMn_DATA_BYTE_0(Classic_CAN[instance] ? 0x0C : 0xCC);
+}
 
-    /* Load LPIT with its maximum value */
-    LPIT0->TMR[2].TVAL = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK;
+/* Tunable frame capacity of each interface's transmission queue, each frame adds 80 bytes of required .bss memory */
+constexpr static std::size_t Tx_Queue_Capacity = 8u;
 
-    /* Enable LPIT channel 2 for timeout start */
-    LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_2(1);
+/* Position and width of the CODE field in the Control and Status word of a message buffer */
+constexpr static std::uint32_t MB_Code_Shift = 24u;
+constexpr static std::uint32_t MB_Code_Mask  = 0xFu << MB_Code_Shift;
 
-    /* Start of timed block */
-    while (delta < cycles_timeout)
-    {
-        /* Check if the flag has been set */
-        if (!(flagRegister & flag_Mask))
-        {
-            return Result::Success;
-        }
+/* BUSY bit of the CODE field, set while FlexCAN moves a received frame into the message buffer */
+constexpr static std::uint32_t MB_Busy_Mask = 0x1u << MB_Code_Shift;
 
-        /* Get current value of delta */
-        delta = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK - (LPIT0->TMR[2].CVAL);
-    }
+/* Maximum number of reads of a BUSY Control and Status word, the move-in lasts a few peripheral clock cycles */
+constexpr static std::uint8_t MB_Busy_Retries = 8u;
 
-    /* If this section is reached, means timeout ocurred and return error status is returned */
-    return Result::Failure;
-}
+/* Position of the local priority field (PRIO) in the ID word of a message buffer, used when MCR[LPRIOEN] is set */
+constexpr static std::uint32_t MB_Prio_Shift = 29u;
 
-/**
- * Class that encapsulates from the Interface the walkaround interrupt required by the driver,
- * only available for the driver's implementation and not for it's user.
+/* Default lowest UAVCAN priority class accepted by each transmission MB, by default every MB accepts every class */
+constexpr static std::uint8_t Default_TX_Lane_Priority[] = {7u, 7u};
+
+/* Message buffer CODE values for reception */
+enum MB_RX_code : std::uint8_t
+{
+    RX_Full    = 0x2, /* MB holds a received frame not yet read */
+    RX_Empty   = 0x4, /* MB is active and empty */
+    RX_Overrun = 0x6  /* MB was overwritten by a new frame before the previous one was read */
+};
+
+/* Message buffer CODE values for transmission */
+enum MB_TX_code : std::uint8_t
+{
+    TX_Inactive = 0x8, /* MB doesn't participate in arbitration, also set after a successful transmission */
+    TX_Abort    = 0x9, /* MB was aborted before winning arbitration, written by the CPU for requesting it */
+    TX_Data     = 0xC  /* MB has a data frame pending for transmission */
+};
+
+/*
+ * Transmission queue of an interface, frames are kept sorted by ascending CAN ID (highest priority first) and in
+ * insertion order among frames with the same ID, so the frames of a multi-frame transfer are never reordered.
  */
-class FlexCAN_interrupt : private InterfaceGroup
+struct TransmitQueue
 {
-private:
-    /*
-     * Helper function for resolving the timestamp of a received frame from FlexCAN'S 16-bit overflowing timer. Based
-     * on Pyuavcan's SourceTimeResolver class from which the terms source and target are used.
-     * Note: A maximum of 820 microseconds is allowed for the reception ISR to reach this function starting from
-     *       a successful frame reception. The computation relies in that no more than a full period from the 16-bit
-     *       timestamping timer running at 80Mhz have passed, this could occur in deadlocks or priority inversion
-     *       scenarios since 820 uSecs constitute a significant amount of cycles, if this happens, timestamps would stop
-     *       being monotonic.
-     * param  frame_timestamp Source clock read from the FlexCAN's peripheral timer.
-     * param  instance        The interface instance number used by the ISR
-     * return time::Monotonic 64-bit timestamp resolved from 16-bit Flexcan's timer samples.
-     */
-    static time::Monotonic resolve_Timestamp(std::uint64_t frame_timestamp, std::uint8_t instance)
-    {
-        /* Harvest the peripheral's current timestamp, this is the 16-bit overflowing source clock */
-        std::uint64_t FlexCAN_timestamp = FlexCAN[instance]->TIMER;
+    InterfaceGroup::FrameType frames[Tx_Queue_Capacity]; /* Frames waiting for a transmission MB */
+    std::uint8_t              count;                     /* Number of frames in the queue */
+    std::uint8_t              reserved;                  /* Slots kept for the frames of the MB's being aborted */
+};
 
-        /* Get an non-overflowing 64-bit timestamp, this is the target clock source */
-        std::uint64_t target_source = static_cast<std::uint64_t>(
-            (static_cast<std::uint64_t>(0xFFFFFFFF - LPIT0->TMR[1].CVAL) << 32) | (0xFFFFFFFF - LPIT0->TMR[0].CVAL));
+/* Transmission queue of each interface */
+static TransmitQueue g_tx_queue[CANFD_Count];
 
-        /* Compute the delta of time that occurred in the source clock */
-        std::uint64_t source_delta = FlexCAN_timestamp > frame_timestamp ? FlexCAN_timestamp - frame_timestamp
-                                                                         : frame_timestamp - FlexCAN_timestamp;
+/* Head frame of each interface taken by readMerged() and not returned yet, it is returned first by read() */
+static InterfaceGroup::FrameType g_merge_head[CANFD_Count];
+static bool                      g_merge_pending[CANFD_Count];
 
-        /* Resolve the received frame's absolute timestamp and divide by 80 due the 80Mhz clock source
-         * of both the source and target timers for converting them into the desired microseconds resolution */
-        std::uint64_t resolved_timestamp_ISR = (target_source - source_delta) / 80;
+/* Readiness of the interfaces for select(), the RX bit of an interface is set while its ISR buffer holds frames and
+ * its TX bit while its transmission queue has room. Only modified with interrupts disabled */
+volatile static std::uint32_t g_ready_mask;
 
-        /* Instantiate the required Monotonic object from the resolved timestamp */
-        return time::Monotonic::fromMicrosecond(resolved_timestamp_ISR);
+/* Copy of the frame loaded in each transmission MB, kept for putting it back in the queue if the MB is aborted */
+static InterfaceGroup::FrameType g_tx_MB_frame[CANFD_Count][TX_MB_Count];
+
+/* Bit mask of the transmission MB's of each interface that hold a pending frame */
+volatile static std::uint32_t g_tx_MB_busy[CANFD_Count];
+
+/* Bit mask of the transmission MB's of each interface with an abort requested, released by the ISR once their
+ * interrupt flag tells the abort or the transmission completed */
+volatile static std::uint32_t g_tx_MB_aborting[CANFD_Count];
+
+/* Lowest UAVCAN priority class accepted by each transmission MB (lane) of each interface */
+static std::uint8_t g_tx_lane_priority[CANFD_Count][TX_MB_Count];
+
+/* Preemption of the transmission MB's enabled for each interface */
+static bool g_tx_preemption[CANFD_Count];
+
+/* Counter for the number of transmission MB's aborted for loading a more urgent frame */
+volatile static std::uint32_t g_preempted_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Counter for the number of aborted frames put back in the transmission queue */
+volatile static std::uint32_t g_requeued_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+
+/* Tunable number of forwarding rules of each direction of the gateway */
+constexpr static std::uint8_t Gateway_Rule_Count = 8u;
+
+/* Instance each FlexCAN instance forwards to, the third instance of the S32K148 isn't bridged */
+constexpr static std::uint8_t Gateway_Peer[] = {1u, 0u, 2u};
+
+/* Forwarding rules of the frames received by each instance */
+static InterfaceGroup::ForwardRule g_gateway_rules[CANFD_Count][Gateway_Rule_Count];
+static std::uint8_t                g_gateway_rule_count[CANFD_Count];
+
+/* Counters of the frames received by each instance and forwarded straight into a MB, through the queue or dropped */
+volatile static std::uint32_t g_forwarded_frames_count[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+volatile static std::uint32_t g_forward_queued_count[CANFD_Count]   = {DISCARD_COUNT_ARRAY};
+volatile static std::uint32_t g_forward_dropped_count[CANFD_Count]  = {DISCARD_COUNT_ARRAY};
+
+/* Maximum and histogram of the latencies in microseconds of the frames received by each instance and forwarded */
+volatile static std::uint32_t g_forward_latency_max[CANFD_Count] = {DISCARD_COUNT_ARRAY};
+volatile static std::uint32_t g_forward_latency_histogram[CANFD_Count][InterfaceGroup::GatewayLatencyBuckets];
+
+/* Transmission MB's of each instance loaded with a forwarded frame, and the frame's reception timestamp */
+volatile static std::uint32_t g_tx_MB_forwarded[CANFD_Count];
+static std::uint64_t          g_tx_MB_ingress[CANFD_Count][TX_MB_Count];
+
+/* Policy for choosing the interface of the frames written by writeBalanced() */
+static InterfaceGroup::BalancePolicy g_balance_policy = InterfaceGroup::BalancePolicy::MostFreeMailboxes;
+
+/* Estimated overhead in bytes of a frame with a 29-bit ID over its payload: arbitration, control, CRC and EOF */
+constexpr static std::uint8_t Frame_Overhead_Bytes = 10u;
+
+/* Tunable window in microseconds of the bus load estimation */
+constexpr static std::uint64_t Bus_Load_Window = 1000u;
+
+/* Bytes transmitted or received by each instance since the last bus load estimation, atomic since the ISR and read()
+ * both account their frames */
+static std::atomic<std::uint32_t> g_bus_bytes[CANFD_Count];
+
+/* Bus load of each instance in bytes per window, averaged between windows, and the time of its last estimation */
+static std::uint32_t g_bus_load[CANFD_Count];
+static std::uint64_t g_bus_load_stamp[CANFD_Count];
+
+/* Token bucket of a transmission rate limit, the tokens are bytes scaled by the 80Mhz ticks per second of the time
+ * base so that the refill of each tick is exact */
+constexpr static std::uint64_t Ticks_Per_Second = 80000000u;
+struct TokenBucket
+{
+    std::uint64_t tokens;    /* Bytes available, scaled by Ticks_Per_Second */
+    std::uint64_t stamp;     /* Time of the last refill in ticks of the time base */
+    std::uint32_t throttled; /* Frames refused for exceeding the limit */
+};
+
+/* Transmission rate limits of each interface, checked in order, and their token buckets */
+static InterfaceGroup::RateLimit g_rate_limits[CANFD_Count][InterfaceGroup::MaxRateLimits];
+static TokenBucket               g_rate_buckets[CANFD_Count][InterfaceGroup::MaxRateLimits];
+static std::uint8_t              g_rate_limit_count[CANFD_Count];
+
+/* Bit mask of the transmission MB's of each interface pinned to a periodic publication, they are also kept busy so
+ * the transmission queue never loads them */
+volatile static std::uint32_t g_tx_MB_pinned[CANFD_Count];
+
+/* Bit mask of the transmission MB's of each interface whose frame copy is loaned for in place serialization, kept
+ * busy until the loan ends */
+volatile static std::uint32_t g_tx_MB_loaned[CANFD_Count];
+
+/* Loan outstanding on each interface, and the staging frame loaned when no transmission MB was idle */
+static bool                      g_tx_loaned[CANFD_Count];
+static InterfaceGroup::FrameType g_tx_loan_frame[CANFD_Count];
+
+/* Periodic publication scheduled from LPIT channel 3, with its pre-encoded frame */
+struct Publication
+{
+    InterfaceGroup::FrameType frame;     /* Template with the payload in the application's byte order */
+    std::uint64_t             period;    /* Period in ticks of the time base, 0 for a free slot */
+    std::uint64_t             due;       /* Time of the next publication in ticks of the time base */
+    std::uint32_t             dirty;     /* Payload words patched since the pinned MB was last written */
+    std::uint32_t             published; /* Frames loaded into the pinned MB or inserted in the queue */
+    std::uint32_t             skipped;   /* Periods skipped for the MB still pending or the queue being full */
+    std::uint8_t              instance;  /* FlexCAN instance number, starts at 0 */
+    std::uint8_t              MB;        /* Pinned transmission MB, TX_MB_Count when published through the queue */
+};
+static Publication g_publications[InterfaceGroup::MaxPublications];
+
+/* Time before its target at which a time-triggered frame is preloaded into an inactive transmission MB, so only the
+ * Control and Status word is written at the target, 200 microseconds in ticks of the time base */
+constexpr static std::uint64_t Timed_Preload_Lead = 16000u;
+
+/* States of a time-triggered frame of the calendar */
+enum TimedState : std::uint8_t
+{
+    Timed_Free,      /* The calendar entry is free */
+    Timed_Scheduled, /* Waiting for its preload */
+    Timed_Loaded,    /* Preloaded into an inactive MB, waiting for its target */
+    Timed_Active,    /* Activated at its target, pending for transmission */
+    Timed_Sent,      /* Transmitted, its SOF timestamp is ready */
+    Timed_Missed     /* No transmission MB was free at its target */
+};
+
+/* Time-triggered frame of an interface's calendar */
+struct TimedFrame
+{
+    InterfaceGroup::FrameType frame;  /* Frame to transmit */
+    std::uint64_t             target; /* Activation time in ticks of the time base */
+    std::uint64_t             sof;    /* Timestamp of the transmitted frame in microseconds */
+    TimedState                state;  /* Progress of the frame */
+    std::uint8_t              MB;     /* Transmission MB once preloaded */
+};
+static TimedFrame g_calendar[CANFD_Count][InterfaceGroup::CalendarLength];
+
+/* Bit mask of the transmission MB's of each interface holding a time-triggered frame, kept busy from their preload */
+volatile static std::uint32_t g_tx_MB_timed[CANFD_Count];
+
+/* Calendar entry of each transmission MB holding a time-triggered frame */
+static std::uint8_t g_tx_MB_timed_entry[CANFD_Count][TX_MB_Count];
+
+/* Reception storm protection of each interface, frames a filter may receive per window, 0 when disabled, and the
+ * length of the windows and of the back-off in ticks of the time base */
+static std::uint32_t g_storm_max_frames[CANFD_Count];
+static std::uint64_t g_storm_window[CANFD_Count];
+static std::uint64_t g_storm_backoff[CANFD_Count];
+
+/* Reception storm monitor of a filter */
+struct StormMonitor
+{
+    std::uint64_t window; /* Start of the current window in ticks of the time base */
+    std::uint64_t until;  /* End of the back-off in ticks of the time base, 0 while unmasked */
+    std::uint32_t frames; /* Frames received in the current window */
+    std::uint32_t events; /* Times the filter's MB's were masked */
+};
+static StormMonitor g_storm[CANFD_Count][Filter_Count];
+
+/* Bit mask in IMASK1 of the reception MB's of each filter, and filter of each reception MB */
+static std::uint32_t g_rx_filter_MBs[CANFD_Count][Filter_Count];
+static std::uint8_t  g_rx_MB_filter[CANFD_Count][RX_MB_Count];
+
+/* Bit mask of the reception MB's of each interface masked by the storm protection */
+volatile static std::uint32_t g_rx_storm_masked[CANFD_Count];
+
+/* Tunable number of distinct ports tracked under each filter by the filter tuning, each adds 20 bytes of required
+ * .bss memory per filter, a filter receiving more ports isn't tightened */
+constexpr static std::uint8_t Tuning_Ports = 8u;
+
+/* Hits of a port under a filter since the application set the filters */
+struct TuningPort
+{
+    std::uint32_t and_ids;  /* Bitwise AND of the CAN ID's received */
+    std::uint32_t or_ids;   /* Bitwise OR of the CAN ID's received */
+    std::uint32_t accepted; /* Frames received */
+    std::uint32_t rejected; /* Frames reported as rejected by the application */
+    std::uint16_t key;      /* Port key as built by port_Key() */
+};
+
+/* Hit statistics of a filter */
+struct FilterHits
+{
+    TuningPort                        ports[Tuning_Ports];
+    std::uint8_t                      port_count;    /* Ports tracked */
+    bool                              overflow;      /* More ports received than tracked */
+    std::uint32_t                     accepted;      /* Frames received in the current epoch */
+    std::uint32_t                     rejected;      /* Frames rejected in the current epoch */
+    std::uint32_t                     last_accepted; /* Frames received in the last closed epoch */
+    std::uint32_t                     last_rejected; /* Frames rejected in the last closed epoch */
+    InterfaceGroup::FrameType::Filter proposed;      /* Proposal of the last closed epoch */
+    std::uint8_t                      stable;        /* Consecutive epochs with the same proposal */
+};
+
+/* Runtime tuning of the filters of an interface */
+struct FilterTuner
+{
+    InterfaceGroup::FilterTuning      config;
+    std::uint64_t                     epoch;           /* Length of the epochs in ticks, 0 when disabled */
+    std::uint64_t                     epoch_start;     /* Start of the current epoch in ticks */
+    std::uint16_t                     tightened;       /* Epochs since the filters were tightened, 0 if they weren't */
+    std::uint8_t                      count;           /* Number of filters */
+    std::uint8_t                      depth[Filter_Count];
+    InterfaceGroup::FrameType::Filter base[Filter_Count];    /* Filters set by the application */
+    InterfaceGroup::FrameType::Filter current[Filter_Count]; /* Filters applied */
+    FilterHits                        hits[Filter_Count];
+};
+static FilterTuner g_tuner[CANFD_Count];
+
+/*
+ * Helper function for checking whether an interface's transmission queue has no room left for a new frame, the slots
+ * reserved for the frames of the MB's being aborted included.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * return true if the queue is full.
+ */
+static inline bool transmitQueue_Full(std::uint8_t instance)
+{
+    return (g_tx_queue[instance].count + g_tx_queue[instance].reserved) >= Tx_Queue_Capacity;
+}
+
+/*
+ * Helper function for inserting a frame in an interface's transmission queue keeping it sorted by CAN ID.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  frame     The frame to insert.
+ * param  before    If true the frame is inserted before the frames with its same ID instead of after them, used
+ *                  for putting back an aborted frame ahead of the frames that follow it in its transfer. Its slot
+ *                  must have been reserved, the reservation is released by the caller.
+ * return true if the frame was inserted, false if the queue is full.
+ */
+static bool transmitQueue_Insert(std::uint8_t instance, const InterfaceGroup::FrameType& frame, bool before)
+{
+    TransmitQueue& queue = g_tx_queue[instance];
+
+    if (transmitQueue_Full(instance))
+    {
+        return false;
     }
 
-public:
-    /*
-     * FlexCAN ISR for frame reception, implements a workaround to the S32K1 FlexCAN's lack of a RX FIFO neither a DMA
-     * triggering mechanism for CAN-FD frames in hardware. Completes in at max 4888 cycles when compiled with g++ at -O3
-     * param instance The FlexCAN peripheral instance number in which the ISR will be executed, starts at 0.
-     *                differing form this library's interface indexes that start at 1.
-     */
-    static void S32K_libuavcan_ISR_handler(std::uint8_t instance)
+    /* Shift one place the frames that go after the new one, starting from the tail */
+    std::uint8_t  position = queue.count;
+    std::uint32_t id       = frame.id & InterfaceGroup::FrameType::MaskExtID;
+    while ((position > 0) && (before ? ((queue.frames[position - 1].id & InterfaceGroup::FrameType::MaskExtID) >= id)
+                                     : ((queue.frames[position - 1].id & InterfaceGroup::FrameType::MaskExtID) > id)))
     {
-        /* Perform the ISR atomically */
-        DISABLE_INTERRUPTS()
+        queue.frames[position] = queue.frames[position - 1];
+        position--;
+    }
 
-        /* Initialize variable for finding which MB received */
-        std::uint8_t MB_index = 0;
+    queue.frames[position] = frame;
+    queue.count++;
 
-        /* Check which RX MB caused the interrupt (0b1111100) mask for 2nd-6th MB */
-        switch (FlexCAN[instance]->IFLAG1 & 124)
-        {
-        case MessageBuffer2:
-            MB_index = 2u; /* Case for 2nd MB */
-            break;
-        case MessageBuffer3:
-            MB_index = 3u; /* Case for 3th MB */
-            break;
-        case MessageBuffer4:
-            MB_index = 4u; /* Case for 4th MB */
-            break;
-        case MessageBuffer5:
-            MB_index = 5u; /* Case for 5th MB */
-            break;
-        case MessageBuffer6:
-            MB_index = 6u; /* Case for 6th MB */
-            break;
-        }
+    if (transmitQueue_Full(instance))
+    {
+        g_ready_mask &= ~InterfaceGroup::readyTX(instance + 1u);
+    }
 
-        /* Validate that the index didn't get stuck at 0, this would be invalid since MB's 0th and 1st are TX */
-        if (MB_index)
-        {
-            /* Receive a frame only if the buffer its under its capacity */
-            if (g_frame_ISRbuffer[instance].size() <= Frame_Capacity)
-            {
-                /* Get the raw DLC from the message buffer that received a frame */
-                std::uint32_t dlc_ISR_raw =
-                    ((FlexCAN[instance]->RAMn[MB_index * MB_Size_Words]) & CAN_WMBn_CS_DLC_MASK) >>
-                    CAN_WMBn_CS_DLC_SHIFT;
+    return true;
+}
 
-                /* Create CAN::FrameDLC type variable from the raw dlc */
-                CAN::FrameDLC dlc_ISR = CAN::FrameDLC(dlc_ISR_raw);
+/*
+ * Helper function for removing the head (highest priority frame) of an interface's transmission queue.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ */
+static void transmitQueue_Pop(std::uint8_t instance)
+{
+    TransmitQueue& queue = g_tx_queue[instance];
 
-                /* Get the id */
-                std::uint32_t id_ISR = (FlexCAN[instance]->RAMn[MB_index * MB_Size_Words + 1]) & CAN_WMBn_ID_ID_MASK;
+    for (std::uint8_t i = 1; i < queue.count; i++)
+    {
+        queue.frames[i - 1] = queue.frames[i];
+    }
 
-                /* Get the address of the payload field for constructing a frame object, it performs a copy */
-                std::uint8_t* payload_byte = reinterpret_cast<std::uint8_t*>(
-                    const_cast<std::uint32_t*>(&(FlexCAN[instance]->RAMn[MB_index * MB_Size_Words + MB_Data_Offset])));
+    queue.count--;
+    g_ready_mask |= InterfaceGroup::readyTX(instance + 1u);
+}
 
-                /* Harvest the frame's 16-bit hardware timestamp */
-                std::uint64_t MB_timestamp = FlexCAN[instance]->RAMn[MB_index * MB_Size_Words] & 0xFFFF;
+/* Tunable number of UAVCAN ports that can be registered in the reception dispatch table of each interface */
+constexpr static std::size_t Dispatch_Port_Count = 8u;
 
-                /* Instantiate monotonic object form a resolved timestamp */
-                time::Monotonic timestamp_ISR = resolve_Timestamp(MB_timestamp, instance);
+/* Tunable frame capacity of each registered port's queue, each frame adds 80 bytes of required .bss memory */
+constexpr static std::size_t Port_Frame_Capacity = 4u;
 
-                /* Create Frame object with constructor */
-                InterfaceGroup::FrameType FrameISR(id_ISR, payload_byte, dlc_ISR, timestamp_ISR);
+/* Fields of the UAVCAN v1 29-bit CAN ID used by the dispatch stage */
+constexpr static std::uint32_t ID_Priority_Shift = 26u;       /* Bits 28-26: transfer priority */
+constexpr static std::uint32_t ID_Priority_Mask  = 0x7u;      /* Eight priority levels, 0 is the highest */
+constexpr static std::uint32_t ID_Service_Flag   = 1u << 25u; /* Bit 25: service not message */
+constexpr static std::uint32_t ID_Subject_Shift  = 8u;        /* Bits 20-8: subject ID of a message */
+constexpr static std::uint32_t ID_Subject_Mask   = 0x1FFFu;   /* 13-bit subject ID */
+constexpr static std::uint32_t ID_Service_Shift  = 14u;       /* Bits 22-14: service ID of a request/response */
+constexpr static std::uint32_t ID_Service_Mask   = 0x1FFu;    /* 9-bit service ID */
+constexpr static std::uint32_t ID_Source_Mask    = 0x7Fu;     /* Bits 6-0: source node ID */
+constexpr static std::uint16_t Port_Key_Service  = 1u << 15u; /* Flag distinguishing service keys from subjects */
 
-                /* Insert the frame into the queue */
-                g_frame_ISRbuffer[instance].push_back(FrameISR);
-            }
-            else
-            {
-                /* Increment the number of discarded frames due to full RX dequeue */
-                g_discarded_frames_count[instance]++;
-            }
+/* Number of subscribers of each registered port */
+constexpr static std::size_t Port_Subscribers = InterfaceGroup::MaxSubscribers;
+
+/* Subscriber sharing the frames of a port */
+struct PortSubscriber
+{
+    InterfaceGroup::SharedCallback callback; /* Called from the ISR with each frame */
+    void*                          context;  /* Pointer passed back to the callback */
+};
+
+/*
+ * Entry of an interface's reception dispatch table, the table is kept sorted by key so the ISR finds the port of a
+ * frame with a binary search. The frames queue is a single producer (ISR) single consumer (readPort) ring buffer,
+ * frames are stored with the payload in FlexCAN's big-endian order just as in the shared ISR buffer.
+ */
+struct DispatchPort
+{
+    std::uint16_t                key;                           /* Port key as built by port_Key() */
+    InterfaceGroup::PortCallback callback;                      /* Called from the ISR instead of queueing if set */
+    InterfaceGroup::FrameType    frames[Port_Frame_Capacity];   /* Storage of the port's frame queue */
+    volatile std::uint8_t        head;                          /* Index of the next frame to read */
+    volatile std::uint8_t        tail;                          /* Index of the next free slot */
+    volatile std::uint32_t       discarded;                     /* Frames dropped due to the port's queue being full */
+    PortSubscriber               subscribers[Port_Subscribers]; /* Subscribers sharing the port's frames */
+    std::uint8_t                 subscriber_count;              /* Number of subscribers */
+};
+
+/* Tunable number of slots of the pool of frames shared by the subscribers of a port, each adds 84 bytes of required
+ * .bss memory */
+constexpr static std::uint8_t Shared_Frame_Capacity = 8u;
+
+/* Slot of the pool of shared frames, free while nothing references it */
+struct SharedFrame
+{
+    InterfaceGroup::FrameType frame; /* Frame with the payload in little-endian order */
+    std::atomic<std::uint8_t> refs;  /* Handles referencing the frame */
+};
+static SharedFrame g_shared_frames[Shared_Frame_Capacity];
 
-            /* Clear MB interrupt flag (write 1 to clear)*/
-            FlexCAN[instance]->IFLAG1 |= (1u << MB_index);
+/*
+ * Helper function for taking a free slot from the pool of shared frames, safe from any context.
+ * return Index of the slot, referenced once, Shared_Frame_Capacity if every slot is referenced.
+ */
+static std::uint8_t shared_Acquire()
+{
+    for (std::uint8_t i = 0; i < Shared_Frame_Capacity; i++)
+    {
+        std::uint8_t free = 0;
+        if (g_shared_frames[i].refs.compare_exchange_strong(free, 1u))
+        {
+            return i;
+        }
+    }
+
+    return Shared_Frame_Capacity;
+}
+
+/* Reception dispatch table of each interface and its number of registered ports */
+static DispatchPort g_dispatch_table[CANFD_Count][Dispatch_Port_Count];
+static std::uint8_t g_dispatch_count[CANFD_Count];
+
+/*
+ * Helper function for building the dispatch key of a port.
+ * param  port_id    Subject or service ID.
+ * param  is_service True for service ports.
+ * return Key in the order used by the dispatch tables.
+ */
+static inline std::uint16_t port_Key(std::uint16_t port_id, bool is_service)
+{
+    return static_cast<std::uint16_t>(port_id | (is_service ? Port_Key_Service : 0u));
+}
+
+/*
+ * Helper function for decoding the dispatch key of a frame from its UAVCAN v1 CAN ID.
+ * param  id  The 29-bit CAN ID of the frame.
+ * return Key of the subject or service the frame belongs to.
+ */
+static inline std::uint16_t port_Key(std::uint32_t id)
+{
+    return (id & ID_Service_Flag)
+               ? port_Key(static_cast<std::uint16_t>((id >> ID_Service_Shift) & ID_Service_Mask), true)
+               : port_Key(static_cast<std::uint16_t>((id >> ID_Subject_Shift) & ID_Subject_Mask), false);
+}
+
+/*
+ * Helper function for decoding the UAVCAN priority class of a frame from its CAN ID.
+ * param  id  The 29-bit CAN ID of the frame.
+ * return Priority class, 0 is the highest and 7 the lowest.
+ */
+static inline std::uint8_t frame_Priority(std::uint32_t id)
+{
+    return static_cast<std::uint8_t>((id >> ID_Priority_Shift) & ID_Priority_Mask);
+}
+
+/*
+ * Helper function for finding a port in an interface's dispatch table, binary search over the sorted keys.
+ * param  instance The FlexCAN instance number, starts at 0.
+ * param  key      Key of the port.
+ * return Pointer to the port or nullptr if it isn't registered.
+ */
+static inline DispatchPort* dispatch_Find(std::uint8_t instance, std::uint16_t key)
+{
+    std::uint8_t low  = 0;
+    std::uint8_t high = g_dispatch_count[instance];
+
+    while (low < high)
+    {
+        std::uint8_t middle = static_cast<std::uint8_t>((low + high) >> 1u);
+
+        if (g_dispatch_table[instance][middle].key < key)
+        {
+            low = static_cast<std::uint8_t>(middle + 1u);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return ((low < g_dispatch_count[instance]) && (g_dispatch_table[instance][low].key == key))
+               ? &g_dispatch_table[instance][low]
+               : nullptr;
+}
+
+/*
+ * Helper function for converting a frame's payload from FlexCAN's big-endian order to little-endian, in place and
+ * in native 32-bit words.
+ * param  frame The frame whose payload is swapped.
+ */
+static inline void payload_ByteSwap(InterfaceGroup::FrameType& frame)
+{
+    /* Get the address of the payload for performing a byte swap in faster native 32-bit words */
+    std::uint32_t* data_address = reinterpret_cast<std::uint32_t*>(frame.data);
+
+    /* Ceil for the number of words in the payload,  */
+    std::uint8_t payload_length_words = (frame.getDataLength() >> 2) +
+                                        std::min(1, (static_cast<std::uint8_t>(frame.getDataLength()) & 0x3));
+
+    /* Perform byte swap */
+    for (std::uint8_t i = 0; i < payload_length_words; i++)
+    {
+        REV_BYTES_32(data_address[i], data_address[i]);
+    }
+}
+
+/*
+ * Helper function for accounting the traffic of an instance in its bus load estimation, from any context.
+ * param  instance        The FlexCAN instance number, starts at 0.
+ * param  payload_length  Payload length in bytes of the frame transmitted or received.
+ */
+static inline void bus_Account(std::uint8_t instance, std::uint_fast8_t payload_length)
+{
+    g_bus_bytes[instance].fetch_add(payload_length + Frame_Overhead_Bytes, std::memory_order_relaxed);
+}
+
+/*
+ * Helper function for checking whether a received frame exceeded the maximum frame age of its instance.
+ * param  instance The FlexCAN instance number, starts at 0.
+ * param  frame    The received frame.
+ * param  now      The current time in microseconds.
+ * return true if the maximum frame age is enabled and the frame is older.
+ */
+static inline bool frame_Expired(std::uint8_t instance, const InterfaceGroup::FrameType& frame, std::uint64_t now)
+{
+    return g_max_frame_age[instance] && ((now - frame.timestamp.toMicrosecond()) > g_max_frame_age[instance]);
+}
+
+/*
+ * Helper function for checking if an instance is in bus off state.
+ * param  instance The FlexCAN instance number, starts at 0.
+ * return true if the instance's fault confinement state is bus off.
+ */
+static inline bool bus_Off(std::uint8_t instance)
+{
+    return ((FlexCAN[instance]->ESR1 & CAN_ESR1_FLTCONF_MASK) >> CAN_ESR1_FLTCONF_SHIFT) >= 2u;
+}
+
+/*
+ * Helper function for checking if a frame of a subject or service is still pending transmission in an instance,
+ * either queued or loaded in a transmission MB. Must be called with interrupts disabled.
+ * param  instance The FlexCAN instance number, starts at 0.
+ * param  key      Dispatch key of the subject or service.
+ * return true if such a frame is pending.
+ */
+static bool tx_Holds_Key(std::uint8_t instance, std::uint16_t key)
+{
+    for (std::uint8_t i = 0; i < g_tx_queue[instance].count; i++)
+    {
+        if (port_Key(g_tx_queue[instance].frames[i].id & InterfaceGroup::FrameType::MaskExtID) == key)
+        {
+            return true;
+        }
+    }
+
+    for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+    {
+        if ((g_tx_MB_busy[instance] & ~(g_tx_MB_pinned[instance] | g_tx_MB_loaned[instance]) & (1u << i)) &&
+            (port_Key(g_tx_MB_frame[instance][i].id & InterfaceGroup::FrameType::MaskExtID) == key))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Helper function for reading the driver's 64-bit monotonic time base, made of the chained LPIT channels 0 and 1.
+ * return Number of 80Mhz ticks elapsed since the time base was started.
+ */
+static inline std::uint64_t time_Ticks()
+{
+    return static_cast<std::uint64_t>((static_cast<std::uint64_t>(0xFFFFFFFF - LPIT0->TMR[1].CVAL) << 32) |
+                                      (0xFFFFFFFF - LPIT0->TMR[0].CVAL));
+}
+
+/*
+ * Helper function for the rate limit of a frame about to be queued, the first limit whose ID and mask match the
+ * frame is refilled for the time elapsed and charged the frame's estimated bytes on the bus. Interfaces without
+ * limits return right away.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  frame     The frame to queue.
+ * return true if the frame is within its limit or matches none, false if it was throttled.
+ */
+static inline bool rate_Admit(std::uint8_t instance, const InterfaceGroup::FrameType& frame)
+{
+    if (!g_rate_limit_count[instance])
+    {
+        return true;
+    }
+
+    std::uint32_t id = frame.id & InterfaceGroup::FrameType::MaskExtID;
+    for (std::uint8_t i = 0; i < g_rate_limit_count[instance]; i++)
+    {
+        const InterfaceGroup::RateLimit& limit = g_rate_limits[instance][i];
+        if ((id & limit.mask) != (limit.id & limit.mask))
+        {
+            continue;
+        }
+
+        TokenBucket&        bucket   = g_rate_buckets[instance][i];
+        const std::uint64_t now      = time_Ticks();
+        const std::uint64_t capacity = static_cast<std::uint64_t>(limit.burst) * Ticks_Per_Second;
+        const std::uint64_t cost =
+            static_cast<std::uint64_t>(frame.getDataLength() + Frame_Overhead_Bytes) * Ticks_Per_Second;
+
+        /* Refill, a bucket idle for longer than it takes to fill up is simply full */
+        const std::uint64_t elapsed = now - bucket.stamp;
+        bucket.stamp                = now;
+        bucket.tokens =
+            (elapsed >= (capacity / limit.rate)) ? capacity : std::min(capacity, bucket.tokens + elapsed * limit.rate);
+
+        if (bucket.tokens < cost)
+        {
+            bucket.throttled++;
+            return false;
+        }
+
+        bucket.tokens -= cost;
+        return true;
+    }
+
+    return true;
+}
+
+/* Tunable capacity of the submission ring of each interface, a power of 2, each slot adds 88 bytes of required .bss
+ * memory */
+constexpr static std::uint32_t Submit_Ring_Capacity = 8u;
+static_assert(!(Submit_Ring_Capacity & (Submit_Ring_Capacity - 1u)), "Submission ring capacity must be a power of 2");
+
+/* Slot of a submission ring, its sequence equals the position of the producer that may fill it, or that position
+ * plus one once its frame is published to the consumer */
+struct SubmitSlot
+{
+    InterfaceGroup::FrameType  frame;    /* Submitted frame */
+    std::atomic<std::uint32_t> sequence; /* Position the slot is at in the ring's laps */
+};
+
+/* Lock-free multi-producer single-consumer ring through which any context submits frames, drained by the ISR */
+struct SubmitRing
+{
+    SubmitSlot                 slots[Submit_Ring_Capacity]; /* Storage of the ring */
+    std::atomic<std::uint32_t> enqueue;                     /* Position claimed by the next producer */
+    std::uint32_t              dequeue;                     /* Position of the next frame to drain */
+};
+static SubmitRing g_submit_ring[CANFD_Count];
+
+/*
+ * Helper function for moving the frames submitted to an interface into its transmission queue, as long as it has
+ * room. Must be called with interrupts disabled, which makes the caller the ring's single consumer. A frame still
+ * being written by a preempted producer stops the draining, its producer pends the ISR again once it's published.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * return true if any frame was inserted in the transmission queue.
+ */
+static bool submit_Drain(std::uint8_t instance)
+{
+    SubmitRing& ring     = g_submit_ring[instance];
+    bool        inserted = false;
+
+    while (!transmitQueue_Full(instance))
+    {
+        SubmitSlot& slot = ring.slots[ring.dequeue & (Submit_Ring_Capacity - 1u)];
+        if (slot.sequence.load(std::memory_order_acquire) != (ring.dequeue + 1u))
+        {
+            break;
+        }
+
+        /* A throttled frame is dropped, its limit counts it */
+        if (rate_Admit(instance, slot.frame))
+        {
+            inserted |= transmitQueue_Insert(instance, slot.frame, false);
+        }
+
+        /* Hand the slot to the producer of the next lap */
+        slot.sequence.store(ring.dequeue + Submit_Ring_Capacity, std::memory_order_release);
+        ring.dequeue++;
+    }
+
+    return inserted;
+}
+
+/*
+ * Helper function for starting a software triggered eDMA transfer of a payload with a completion interrupt, the
+ * descriptor is programmed by edma_ProgramCopy().
+ * param  channel      The eDMA channel used.
+ * param  source       Address of the first payload word to copy.
+ * param  destination  Address where the payload is copied to.
+ * param  words        Number of 32-bit words of the payload.
+ * param  byte_swap    Reverse the byte order of each word.
+ */
+static void dma_Start(std::uint8_t         channel,
+                      const volatile void* source,
+                      volatile void*       destination,
+                      std::uint8_t         words,
+                      bool                 byte_swap)
+{
+    edma_ProgramCopy(DMA->TCD[channel], channel, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(source)),
+                     static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(destination)), words, byte_swap);
+
+    /* Software trigger */
+    DMA->SSRT = DMA_SSRT_SSRT(channel);
+}
+
+/*
+ * Helper function for starting the eDMA reception channel of a classic instance, which copies the RX FIFO's output MB
+ * into the instance's ring on every FIFO request. The source and destination address modulos wrap around the MB and
+ * the ring respectively, so the channel runs indefinitely. Each frame is a whole major loop whose interrupt stamps
+ * the frame and counts it in the ring's tail.
+ * param  instance The FlexCAN instance number, starts at 0.
+ */
+static void classic_StartDMA(std::uint8_t instance)
+{
+    const std::uint8_t channel = DMA_RX_Channel[instance];
+    auto&              TCD     = DMA->TCD[channel];
+
+    /* Ring size in bytes as a power of two for the destination modulo */
+    std::uint8_t ring_modulo = 0;
+    while ((1u << ring_modulo) < Classic_Ring_Capacity * sizeof(ClassicFrame))
+    {
+        ring_modulo++;
+    }
+
+    TCD.SADDR           = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&FlexCAN[instance]->RAMn[0]));
+    TCD.SOFF            = 4u;
+    TCD.DADDR           = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(g_classic_ring[instance]));
+    TCD.DOFF            = 4u;
+    TCD.ATTR            = DMA_TCD_ATTR_SMOD(4) | DMA_TCD_ATTR_SSIZE(2) |         /* Reads wrapping around the MB */
+                          DMA_TCD_ATTR_DMOD(ring_modulo) | DMA_TCD_ATTR_DSIZE(2); /* Writes wrapping around the ring */
+    TCD.NBYTES.MLOFFYES = DMA_TCD_NBYTES_MLOFFYES_NBYTES(sizeof(ClassicFrame)); /* A frame per FIFO request */
+    TCD.SLAST           = 0;
+    TCD.DLASTSGA        = 0;
+    TCD.CITER.ELINKNO   = DMA_TCD_CITER_ELINKNO_CITER(1);
+    TCD.BITER.ELINKNO   = DMA_TCD_BITER_ELINKNO_BITER(1);
+    TCD.CSR             = DMA_TCD_CSR_INTMAJOR_MASK; /* Interrupt per frame, the channel stays enabled */
+
+    /* Route the FIFO's request to the channel and enable it */
+    PCC->PCCn[PCC_DMAMUX_INDEX] |= PCC_PCCn_CGC_MASK;
+    DMAMUX->CHCFG[channel] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(FlexCAN_DMA_Request[instance]);
+    DMA->SERQ              = DMA_SERQ_SERQ(channel);
+}
+
+/*
+ * Helper function for finding the RX MB holding the oldest frame among a set of flagged ones, frames that matched
+ * the MB's of the same filter group (or of different filters) are drained in arrival order this way. The age is
+ * measured modulo the 16-bit period of the FlexCAN timer. Reading the Control and Status words moves the MB lock
+ * along, the caller locks the selected MB afterwards.
+ * param  FlexCAN_base Base address of the FlexCAN instance.
+ * param  RX_flags     Bit mask of the flagged RX MB's, must not be zero.
+ * return Index of the MB with the oldest frame.
+ */
+static inline std::uint8_t oldest_MB(CAN_Type* const FlexCAN_base, std::uint32_t RX_flags)
+{
+    std::uint16_t timer    = static_cast<std::uint16_t>(FlexCAN_base->TIMER);
+    std::uint8_t  MB_index = 0;
+    std::uint16_t MB_age   = 0;
+
+    for (std::uint8_t i = TX_MB_Count; i < TX_MB_Count + RX_MB_Count; i++)
+    {
+        if (RX_flags & (1u << i))
+        {
+            std::uint16_t age =
+                static_cast<std::uint16_t>(timer - (FlexCAN_base->RAMn[i * MB_Size_Words] & 0xFFFFu));
+
+            if (!MB_index || (age > MB_age))
+            {
+                MB_index = i;
+                MB_age   = age;
+            }
+        }
+    }
+
+    return MB_index;
+}
+
+/*
+ * Helper function for locking a RX message buffer following FlexCAN's read sequence: reading the Control and Status
+ * word locks the MB, so a new frame can't be moved into it while its ID and payload are copied, and reading the
+ * free-running timer afterwards unlocks it. A BUSY word is read again until the move-in completes.
+ * param  MB Address of the message buffer to lock.
+ * return The Control and Status word of the locked MB.
+ */
+static inline std::uint32_t lock_MB(volatile std::uint32_t* const MB)
+{
+    std::uint32_t MB_CS = MB[0];
+
+    for (std::uint8_t retry = 0; (MB_CS & MB_Busy_Mask) && (retry < MB_Busy_Retries); retry++)
+    {
+        MB_CS = MB[0];
+    }
+
+    return MB_CS;
+}
+
+/*
+ * Helper function for checking the Control and Status word of a locked RX message buffer.
+ * param  instance The FlexCAN instance number, starts at 0.
+ * param  MB_CS    Control and Status word read when locking the MB.
+ * return true if the MB holds a complete frame, counting it if it overwrote an unread one; false if it doesn't
+ *        hold one, which is counted as a torn frame.
+ */
+static inline bool MB_Holds_Frame(std::uint8_t instance, std::uint32_t MB_CS)
+{
+    const std::uint32_t MB_code = (MB_CS & MB_Code_Mask) >> MB_Code_Shift;
+
+    if (MB_code == RX_Overrun)
+    {
+        g_overrun_frames_count[instance]++;
+    }
+    else if (MB_code != RX_Full)
+    {
+        g_torn_frames_count[instance]++;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Helper function for configuring the reception MB's of a FlexCAN instance in freeze mode, each filter takes as many
+ * consecutive MB's as its depth so that, with IRMQ enabled, FlexCAN spills a burst of matching frames into the next
+ * free MB of the group instead of overrunning the first one. The unused RX MB's are left inactive.
+ * param  instance              The FlexCAN instance number, starts at 0.
+ * param  filter_config         The filters to apply.
+ * param  filter_depth          Number of MB's of each filter, nullptr for one MB each.
+ * param  filter_config_length  The length of the @p filter_config argument.
+ */
+static void configure_Filters(std::uint8_t                                      instance,
+                              const typename InterfaceGroup::FrameType::Filter* filter_config,
+                              const std::uint8_t*                               filter_depth,
+                              std::size_t                                       filter_config_length)
+{
+    /* Keep the applied filters for the filter tuning */
+    FilterTuner& tuner = g_tuner[instance];
+    tuner.count        = static_cast<std::uint8_t>(std::min<std::size_t>(filter_config_length, Filter_Count));
+    for (std::uint8_t j = 0; j < tuner.count; j++)
+    {
+        tuner.current[j].id   = filter_config[j].id;
+        tuner.current[j].mask = filter_config[j].mask;
+        tuner.depth[j]        = filter_depth ? filter_depth[j] : 1u;
+    }
+
+    /* Classic instances filter through the ID filter table of their RX FIFO, whose depth is fixed */
+    if (Classic_CAN[instance])
+    {
+        for (std::uint8_t j = 0; j < Classic_Filter_Elements; j++)
+        {
+            if (j < filter_config_length)
+            {
+                /* Extended data frames whose ID matches the filter under its mask */
+                FlexCAN[instance]->RAMn[Classic_Filter_Word + j] =
+                    Classic_Filter_IDE | (filter_config[j].id << Classic_Filter_Shift);
+                FlexCAN[instance]->RXIMR[j] =
+                    Classic_Filter_RTR | Classic_Filter_IDE | (filter_config[j].mask << Classic_Filter_Shift);
+            }
+            else
+            {
+                /* The unused elements only accept an extended remote frame of ID 0, which UAVCAN doesn't use */
+                FlexCAN[instance]->RAMn[Classic_Filter_Word + j] = Classic_Filter_RTR | Classic_Filter_IDE;
+                FlexCAN[instance]->RXIMR[j]                      = 0xFFFFFFFFu;
+            }
+        }
+        return;
+    }
+
+    /* Reset all previous filter configurations, the transmission MB's keep their pending frames */
+    for (std::uint8_t j = TX_MB_Count * MB_Size_Words; j < CAN_RAMn_COUNT; j++)
+    {
+        FlexCAN[instance]->RAMn[j] = 0;
+    }
+
+    /* Restart the storm monitors, the MB's masked by them are unmasked since their filters are replaced */
+    for (std::uint8_t j = 0; j < Filter_Count; j++)
+    {
+        g_storm[instance][j]         = {0, 0, 0, 0};
+        g_rx_filter_MBs[instance][j] = 0;
+    }
+    if (!g_rx_polling[instance])
+    {
+        FlexCAN[instance]->IMASK1 |= g_rx_storm_masked[instance];
+    }
+    g_rx_storm_masked[instance] = 0;
+
+    /* Clear the reception masks before configuring the new ones needed */
+    for (std::uint8_t j = 0; j < CAN_RXIMR_COUNT; j++)
+    {
+        FlexCAN[instance]->RXIMR[j] = 0;
+    }
+
+    /* Setup Message buffers 2nd-6th for reception and set filters */
+    std::uint8_t MB_index = TX_MB_Count;
+    for (std::uint8_t j = 0; j < filter_config_length; j++)
+    {
+        for (std::uint8_t k = 0; k < (filter_depth ? filter_depth[j] : 1u); k++, MB_index++)
+        {
+            /* Setup reception MB's mask from input argument */
+            FlexCAN[instance]->RXIMR[MB_index] = filter_config[j].mask;
+
+            /* Group the MB under its filter for the storm protection */
+            g_rx_filter_MBs[instance][j] |= 1u << MB_index;
+            g_rx_MB_filter[instance][MB_index - TX_MB_Count] = j;
+
+            /* Setup word 0 (4 Bytes) for ith MB
+             * Extended Data Length      (EDL) = 1
+             * Bit Rate Switch           (BRS) = 1
+             * Error State Indicator     (ESI) = 0
+             * Message Buffer Code      (CODE) = 4 ( Active for reception and empty )
+             * Substitute Remote Request (SRR) = 0
+             * ID Extended Bit           (IDE) = 1
+             * Remote Tx Request         (RTR) = 0
+             * Data Length Code          (DLC) = 0 ( Valid for transmission only )
+             * Counter Time Stamp (TIME STAMP) = 0 ( Handled by hardware )
+             */
+            FlexCAN[instance]->RAMn[MB_index * MB_Size_Words] = CAN_RAMn_DATA_BYTE_0(0xC4) | CAN_RAMn_DATA_BYTE_1(0x20);
+
+            /* Setup Message buffers 2-7 29-bit extended ID from parameter */
+            FlexCAN[instance]->RAMn[MB_index * MB_Size_Words + 1] = filter_config[j].id;
+        }
+    }
+}
+
+/*
+ * Helper function for validating the filters and depths of a filter configuration.
+ * param  filter_depth          Number of MB's of each filter, nullptr for one MB each.
+ * param  filter_config_length  The number of filters.
+ * return true if every filter takes at least one MB and they fit in the RX MB's.
+ */
+static bool validate_Filters(const std::uint8_t* filter_depth, std::size_t filter_config_length)
+{
+    std::size_t MB_total = filter_depth ? 0u : filter_config_length;
+
+    for (std::size_t j = 0; filter_depth && (j < filter_config_length); j++)
+    {
+        if (!filter_depth[j])
+        {
+            return false;
+        }
+        MB_total += filter_depth[j];
+    }
+
+    return (filter_config_length <= Filter_Count) && (MB_total <= RX_MB_Count);
+}
+
+/*
+ * Helper function for the prescaler division factor that yields a bit rate from the 80Mhz FlexCAN clock.
+ * param  bitrate  The desired bit rate in bit/s.
+ * param  quantas  The time quantas per bit of the segment configuration.
+ * return The division factor, or 0 if the bit rate isn't exactly reachable by the prescaler.
+ */
+static std::uint32_t bitrate_Prescaler(std::uint32_t bitrate, std::uint32_t quantas)
+{
+    std::uint32_t factor = 0u;
+
+    if (bitrate && (bitrate <= (FlexCAN_Clock_Hz / quantas)) && !(FlexCAN_Clock_Hz % (bitrate * quantas)))
+    {
+        factor = FlexCAN_Clock_Hz / (bitrate * quantas);
+    }
+
+    return (factor <= Max_Prescaler_Factor) ? factor : 0u;
+}
+
+/*
+ * Helper function for block polling a bit flag until it is set with a timeout of 0.2 seconds using a LPIT timer,
+ * the argument list and usage reassembles the classic block polling while loop, and instead of using a third
+ * argument to decide if it'ss a timed block for a clear or set, the two flavors of the function are provided.
+ *
+ * param  flagRegister Register where the flag is located.
+ * param  flagMask     Mask to AND'nd with the register for isolating the flag.
+ * return Result::Success If the flag set before the timeout expiration..
+ * return Result::Failure If a timeout ocurred before the desired flag set.
+ */
+Result flagPollTimeout_Set(volatile std::uint32_t& flagRegister, std::uint32_t flag_Mask)
+{
+    /* Initialization of delta for timeout measurement */
+    volatile std::uint32_t delta = 0;
+
+    /* Disable LPIT channel 2 for loading */
+    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_2(1);
+
+    /* Load LPIT with its maximum value */
+    LPIT0->TMR[2].TVAL = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK;
+
+    /* Enable LPIT channel 2 for timeout start */
+    LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_2(1);
+
+    /* Start of timed block */
+    while (delta < cycles_timeout)
+    {
+        /* Check if the flag has been set */
+        if (flagRegister & flag_Mask)
+        {
+            return Result::Success;
+        }
+
+        /* Get current value of delta */
+        delta = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK - (LPIT0->TMR[2].CVAL);
+    }
+
+    /* If this section is reached, means timeout ocurred and return error status is returned */
+    return Result::Failure;
+}
+
+/*
+ * Helper function for block polling a bit flag until it is cleared with a timeout of 0.2 seconds using a LPIT timer
+ *
+ * param  flagRegister Register where the flag is located.
+ * param  flagMask     Mask to AND'nd with the register for isolating the flag.
+ * return Result::Success If the flag cleared before the timeout expiration..
+ * return Result::Failure If a timeout ocurred before the desired flag cleared.
+ */
+Result flagPollTimeout_Clear(volatile std::uint32_t& flagRegister, std::uint32_t flag_Mask)
+{
+    /* Initialization of delta for timeout measurement */
+    volatile std::uint32_t delta = 0;
+
+    /* Disable LPIT channel 2 for loading */
+    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_2(1);
+
+    /* Load LPIT with its maximum value */
+    LPIT0->TMR[2].TVAL = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK;
+
+    /* Enable LPIT channel 2 for timeout start */
+    LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_2(1);
+
+    /* Start of timed block */
+    while (delta < cycles_timeout)
+    {
+        /* Check if the flag has been set */
+        if (!(flagRegister & flag_Mask))
+        {
+            return Result::Success;
+        }
+
+        /* Get current value of delta */
+        delta = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK - (LPIT0->TMR[2].CVAL);
+    }
+
+    /* If this section is reached, means timeout ocurred and return error status is returned */
+    return Result::Failure;
+}
+
+/*
+ * Helper function for replacing the filters of a running FlexCAN instance, enters freeze mode, which halts any
+ * transmission or reception, lays out the new filters and exits it.
+ * param  instance              The FlexCAN instance number, starts at 0.
+ * param  filter_config         The filters to apply.
+ * param  filter_depth          Number of MB's of each filter, nullptr for one MB each.
+ * param  filter_config_length  The length of the @p filter_config argument.
+ * return Result::Success If the instance entered and left freeze mode in time.
+ * return Result::Failure If a timeout ocurred while entering or leaving freeze mode.
+ */
+static Result reconfigure_Instance(std::uint8_t                                      instance,
+                                   const typename InterfaceGroup::FrameType::Filter* filter_config,
+                                   const std::uint8_t*                               filter_depth,
+                                   std::size_t                                       filter_config_length)
+{
+    /* Enter freeze mode for filter reconfiguration */
+    FlexCAN[instance]->MCR |= (CAN_MCR_HALT_MASK | CAN_MCR_FRZ_MASK);
+
+    /* Block for freeze mode entry, halts any transmission or reception */
+    Result Status = flagPollTimeout_Set(FlexCAN[instance]->MCR, CAN_MCR_FRZACK_MASK);
+
+    if (isSuccess(Status))
+    {
+        /* Lay out the filters over the reception MB's */
+        configure_Filters(instance, filter_config, filter_depth, filter_config_length);
+
+        /* Freeze mode exit request */
+        FlexCAN[instance]->MCR &= ~(CAN_MCR_HALT_MASK | CAN_MCR_FRZ_MASK);
+
+        /* Block for freeze mode exit */
+        Status = flagPollTimeout_Clear(FlexCAN[instance]->MCR, CAN_MCR_FRZACK_MASK);
+
+        /* Block until module is ready */
+        if (isSuccess(Status))
+        {
+            Status = flagPollTimeout_Clear(FlexCAN[instance]->MCR, CAN_MCR_NOTRDY_MASK);
+        }
+    }
+
+    return Status;
+}
+
+/*
+ * Helper function for taking the filters applied to an instance as the ones set by the application, which the filter
+ * tuning narrows down, and restarting their hit statistics.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ */
+static void tuning_Rebase(std::uint8_t instance)
+{
+    FilterTuner& tuner = g_tuner[instance];
+
+    DISABLE_INTERRUPTS()
+    for (std::uint8_t j = 0; j < Filter_Count; j++)
+    {
+        FilterHits& hits = tuner.hits[j];
+
+        tuner.base[j].id   = tuner.current[j].id;
+        tuner.base[j].mask = tuner.current[j].mask;
+        hits.port_count    = 0;
+        hits.overflow      = false;
+        hits.accepted      = 0;
+        hits.rejected      = 0;
+        hits.last_accepted = 0;
+        hits.last_rejected = 0;
+        hits.proposed.id   = tuner.current[j].id;
+        hits.proposed.mask = tuner.current[j].mask;
+        hits.stable        = 0;
+    }
+    tuner.tightened   = 0;
+    tuner.epoch_start = time_Ticks();
+    ENABLE_INTERRUPTS()
+}
+
+/*
+ * Helper function for looking up the hits of a port under a filter, tracking it if it is new.
+ * param  hits  The hit statistics of the filter.
+ * param  key   Port key as built by port_Key().
+ * return The hits of the port, nullptr if there's no room for tracking it.
+ */
+static TuningPort* tuning_Port(FilterHits& hits, std::uint16_t key)
+{
+    for (std::uint8_t i = 0; i < hits.port_count; i++)
+    {
+        if (hits.ports[i].key == key)
+        {
+            return &hits.ports[i];
+        }
+    }
+
+    if (hits.port_count >= Tuning_Ports)
+    {
+        hits.overflow = true;
+        return nullptr;
+    }
+
+    TuningPort& port = hits.ports[hits.port_count++];
+    port.and_ids     = InterfaceGroup::FrameType::MaskExtID;
+    port.or_ids      = 0;
+    port.accepted    = 0;
+    port.rejected    = 0;
+    port.key         = key;
+
+    return &port;
+}
+
+/*
+ * Helper function for counting a frame accepted by a filter in its hit statistics, called from the ISR with the
+ * filter tuning enabled.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  MB_index  The reception MB that received the frame.
+ * param  id        The 29-bit CAN ID of the received frame.
+ */
+static void tuning_Count(std::uint8_t instance, std::uint8_t MB_index, std::uint32_t id)
+{
+    FilterHits& hits = g_tuner[instance].hits[g_rx_MB_filter[instance][MB_index - TX_MB_Count]];
+    TuningPort* port = tuning_Port(hits, port_Key(id));
+
+    hits.accepted++;
+    if (port)
+    {
+        port->and_ids &= id;
+        port->or_ids |= id;
+        port->accepted++;
+    }
+}
+
+/*
+ * Helper function for the CAN ID bits of the frames of a port that are fixed by its key: the service flag and the
+ * subject or service ID, the other bits may take any value.
+ * param  key    Port key as built by port_Key().
+ * param  field  Bit mask of the fixed bits.
+ * param  value  Value of the fixed bits.
+ */
+static void port_Bits(std::uint16_t key, std::uint32_t& field, std::uint32_t& value)
+{
+    if (key & Port_Key_Service)
+    {
+        field = ID_Service_Flag | (ID_Service_Mask << ID_Service_Shift);
+        value = ID_Service_Flag | ((key & ID_Service_Mask) << ID_Service_Shift);
+    }
+    else
+    {
+        field = ID_Service_Flag | (ID_Subject_Mask << ID_Subject_Shift);
+        value = (key & ID_Subject_Mask) << ID_Subject_Shift;
+    }
+}
+
+/*
+ * Helper function for closing the epoch of a filter, proposes the filter that keeps the CAN ID bits common to the
+ * ports still used, those with frames not rejected and those registered in the dispatch table that the application's
+ * filter accepts, quiet or not, as long as the epoch's share of rejected frames reaches the threshold and the proposal
+ * leaves out a port only rejected. Otherwise the applied filter is proposed, so a filter is never widened but by
+ * relearning. Called with interrupts disabled.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  filter    The filter's position in the configuration.
+ */
+static void tuning_Propose(std::uint8_t instance, std::uint8_t filter)
+{
+    FilterTuner&                      tuner    = g_tuner[instance];
+    FilterHits&                       hits     = tuner.hits[filter];
+    InterfaceGroup::FrameType::Filter proposal = tuner.current[filter];
+
+    std::uint32_t rejected = std::min(hits.rejected, hits.accepted);
+    if (!hits.overflow && hits.accepted && ((rejected * 100u) >= (hits.accepted * tuner.config.reject_percent)))
+    {
+        std::uint32_t and_ids = InterfaceGroup::FrameType::MaskExtID;
+        std::uint32_t or_ids  = 0;
+        bool          used    = false;
+
+        for (std::uint8_t i = 0; i < hits.port_count; i++)
+        {
+            if (hits.ports[i].rejected < hits.ports[i].accepted)
+            {
+                and_ids &= hits.ports[i].and_ids;
+                or_ids |= hits.ports[i].or_ids;
+                used = true;
+            }
+        }
+
+        /* A registered port is kept even without traffic in the epoch, only the bits of its key are known */
+        for (std::uint8_t i = 0; i < g_dispatch_count[instance]; i++)
+        {
+            std::uint32_t field = 0;
+            std::uint32_t value = 0;
+            port_Bits(g_dispatch_table[instance][i].key, field, value);
+
+            if (!((value ^ tuner.base[filter].id) & tuner.base[filter].mask & field))
+            {
+                and_ids &= value;
+                or_ids |= value | (~field & InterfaceGroup::FrameType::MaskExtID);
+                used = true;
+            }
+        }
+
+        /* The mask grows with the bits every used port agrees on */
+        const std::uint32_t mask =
+            tuner.base[filter].mask | (~(and_ids ^ or_ids) & InterfaceGroup::FrameType::MaskExtID);
+        const std::uint32_t id = and_ids & mask;
+
+        /* A port only rejected is left out if one of its constant bits differs under the new mask */
+        bool excludes = false;
+        for (std::uint8_t i = 0; used && (i < hits.port_count); i++)
+        {
+            const TuningPort& port = hits.ports[i];
+            if ((port.rejected >= port.accepted) && ((port.and_ids ^ id) & mask & ~(port.and_ids ^ port.or_ids)))
+            {
+                excludes = true;
+            }
+        }
+
+        if (excludes)
+        {
+            proposal.id   = id;
+            proposal.mask = mask;
+        }
+    }
+
+    /* Count the epochs the proposal holds */
+    if ((proposal.id == hits.proposed.id) && (proposal.mask == hits.proposed.mask))
+    {
+        hits.stable = static_cast<std::uint8_t>(std::min(hits.stable + 1, 0xFF));
+    }
+    else
+    {
+        hits.proposed.id   = proposal.id;
+        hits.proposed.mask = proposal.mask;
+        hits.stable        = 1;
+    }
+
+    hits.last_accepted = hits.accepted;
+    hits.last_rejected = hits.rejected;
+    hits.accepted      = 0;
+    hits.rejected      = 0;
+}
+
+/*
+ * Helper function for arming LPIT channel 3 to expire at the next due periodic publication, the next preload or
+ * target of a time-triggered frame, or the end of the next storm back-off, it is stopped when there are none. The
+ * channel counts 32 bits at 80Mhz, an event later than 53 seconds wakes the scheduler up early and gets armed again.
+ * param  now  The current time in ticks of the time base.
+ */
+static void scheduler_Arm(std::uint64_t now)
+{
+    std::uint64_t next = std::numeric_limits<std::uint64_t>::max();
+    for (std::uint8_t i = 0; i < InterfaceGroup::MaxPublications; i++)
+    {
+        if (g_publications[i].period && (g_publications[i].due < next))
+        {
+            next = g_publications[i].due;
+        }
+    }
+
+    /* A scheduled frame whose preload time passed without a free MB retries at its target */
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        for (std::uint8_t j = 0; j < InterfaceGroup::CalendarLength; j++)
+        {
+            const TimedFrame& timed = g_calendar[i][j];
+            std::uint64_t     event = std::numeric_limits<std::uint64_t>::max();
+
+            if (timed.state == Timed_Scheduled)
+            {
+                event = ((timed.target > Timed_Preload_Lead) && (now < (timed.target - Timed_Preload_Lead))) ?
+                            (timed.target - Timed_Preload_Lead) :
+                            timed.target;
+            }
+            else if (timed.state == Timed_Loaded)
+            {
+                event = timed.target;
+            }
+
+            next = std::min(next, event);
+        }
+
+        for (std::uint8_t j = 0; j < Filter_Count; j++)
+        {
+            if (g_storm[i][j].until)
+            {
+                next = std::min(next, g_storm[i][j].until);
+            }
+        }
+    }
+
+    /* Disable LPIT channel 3 for loading, a restarted channel counts down from its new value right away */
+    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_3(1);
+
+    if (next != std::numeric_limits<std::uint64_t>::max())
+    {
+        std::uint64_t delta = (next > now) ? (next - now) : 1u;
+
+        LPIT0->TMR[3].TVAL = static_cast<std::uint32_t>(std::min<std::uint64_t>(delta, LPIT_TMR_TVAL_TMR_VAL_MASK));
+        LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_3(1);
+    }
+}
+
+/*
+ * Helper function for counting a frame received by a filter in the storm protection of its instance, called from the
+ * ISR with the protection enabled. The interrupts of the filter's MB's are masked once it exceeds the frames allowed
+ * in the current window, until the scheduler ends the back-off.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  MB_index  The reception MB that received the frame.
+ * param  now       The current time in ticks of the time base.
+ * return The bit mask of the MB's just masked, 0 while the filter is within its threshold.
+ */
+static std::uint32_t storm_Count(std::uint8_t instance, std::uint8_t MB_index, std::uint64_t now)
+{
+    const std::uint8_t filter  = g_rx_MB_filter[instance][MB_index - TX_MB_Count];
+    StormMonitor&      monitor = g_storm[instance][filter];
+
+    /* Start a new window once the current one elapsed */
+    if ((now - monitor.window) >= g_storm_window[instance])
+    {
+        monitor.window = now;
+        monitor.frames = 0;
+    }
+
+    if (++monitor.frames <= g_storm_max_frames[instance])
+    {
+        return 0u;
+    }
+
+    /* Mask the whole filter, with IRMQ a babbling ID would otherwise spill over into the next MB's of its group */
+    const std::uint32_t MBs = g_rx_filter_MBs[instance][filter];
+    FlexCAN[instance]->IMASK1 &= ~MBs;
+    g_rx_storm_masked[instance] |= MBs;
+    monitor.until = now + g_storm_backoff[instance];
+    monitor.events++;
+    scheduler_Arm(now);
+
+    return MBs;
+}
+
+/*
+ * Helper function for discarding the frames held by reception MB's masked by the storm protection, their 16-bit
+ * timestamps may be older than a period of the FlexCAN timer by the end of the back-off and can't be resolved. Each
+ * discarded frame is counted as an overrun, as the ones it overwrote.
+ * param  instance  The FlexCAN instance number, starts at 0.
+ * param  MBs       Bit mask of the reception MB's to release.
+ */
+static void storm_Discard(std::uint8_t instance, std::uint32_t MBs)
+{
+    std::uint32_t held = FlexCAN[instance]->IFLAG1 & MBs;
+
+    for (std::uint8_t i = TX_MB_Count; held; i++)
+    {
+        if (held & (1u << i))
+        {
+            /* Lock the MB, clear its flag and unlock it without copying the frame */
+            if (MB_Holds_Frame(instance, lock_MB(&FlexCAN[instance]->RAMn[i * MB_Size_Words])))
+            {
+                g_overrun_frames_count[instance]++;
+            }
+            FlexCAN[instance]->IFLAG1 = 1u << i;
+            static_cast<void>(FlexCAN[instance]->TIMER);
+
+            held &= ~(1u << i);
+        }
+    }
+}
+
+/*
+ * Helper function for unmasking the reception MB's of the filters whose storm back-off elapsed, called from the
+ * scheduler. The frames held meanwhile are discarded instead of delivered with unresolvable timestamps.
+ * param  now  The current time in ticks of the time base.
+ */
+static void storm_Service(std::uint64_t now)
+{
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        for (std::uint8_t j = 0; j < Filter_Count; j++)
+        {
+            StormMonitor& monitor = g_storm[i][j];
+
+            if (monitor.until && (monitor.until <= now))
+            {
+                monitor.until  = 0;
+                monitor.window = now;
+                monitor.frames = 0;
+                g_rx_storm_masked[i] &= ~g_rx_filter_MBs[i][j];
+
+                if (!g_rx_polling[i])
+                {
+                    storm_Discard(i, g_rx_filter_MBs[i][j]);
+                    FlexCAN[i]->IMASK1 |= g_rx_filter_MBs[i][j];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Class that encapsulates from the Interface the walkaround interrupt required by the driver,
+ * only available for the driver's implementation and not for it's user.
+ */
+class FlexCAN_interrupt : private InterfaceGroup
+{
+private:
+    /*
+     * Helper function for resolving the timestamp of a received frame from FlexCAN'S 16-bit overflowing timer. Based
+     * on Pyuavcan's SourceTimeResolver class from which the terms source and target are used.
+     * Note: A maximum of 820 microseconds is allowed for the reception ISR to reach this function starting from
+     *       a successful frame reception. The computation relies in that no more than a full period from the 16-bit
+     *       timestamping timer running at 80Mhz have passed, this could occur in deadlocks or priority inversion
+     *       scenarios since 820 uSecs constitute a significant amount of cycles, if this happens, timestamps would stop
+     *       being monotonic.
+     * param  frame_timestamp   Source clock read from the FlexCAN's peripheral timer.
+     * param  FlexCAN_timestamp The peripheral's current timestamp, this is the 16-bit overflowing source clock.
+     * param  target_source     The driver's 64-bit time base sampled together with @p FlexCAN_timestamp.
+     * return time::Monotonic 64-bit timestamp resolved from 16-bit Flexcan's timer samples.
+     */
+    static time::Monotonic resolve_Timestamp(std::uint64_t frame_timestamp,
+                                             std::uint64_t FlexCAN_timestamp,
+                                             std::uint64_t target_source)
+    {
+        /* Compute the delta of time that occurred in the source clock, modulo its 16-bit period so an overflow of
+         * the timer between both samples is accounted for */
+        std::uint64_t source_delta = static_cast<std::uint16_t>(FlexCAN_timestamp - frame_timestamp);
+
+        /* Resolve the received frame's absolute timestamp and divide by 80 due the 80Mhz clock source
+         * of both the source and target timers for converting them into the desired microseconds resolution */
+        std::uint64_t resolved_timestamp_ISR = (target_source - source_delta) / 80;
+
+        /* Instantiate the required Monotonic object from the resolved timestamp */
+        return time::Monotonic::fromMicrosecond(resolved_timestamp_ISR);
+    }
+
+    /*
+     * Helper function for copying a received frame out of a locked message buffer into a frame object, the timer is
+     * read last so the MB stays locked until the copy completes.
+     * tparam Instance The interface instance number used by the ISR
+     * param  MB       Address of the message buffer that received the frame.
+     * param  MB_CS    Control and Status word read when locking the MB.
+     * param  frame    Frame object where the message buffer is copied to, the payload keeps FlexCAN's byte order.
+     */
+    template <std::uint8_t Instance>
+    static void harvest_Frame(volatile std::uint32_t* const MB,
+                              std::uint32_t                 MB_CS,
+                              InterfaceGroup::FrameType&    frame)
+    {
+        /* Get the raw DLC from the message buffer that received a frame */
+        CAN::FrameDLC dlc_ISR = CAN::FrameDLC((MB_CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT);
+
+        /* Payload length in bytes for the received DLC */
+        std::uint_fast8_t payload_length = InterfaceGroup::FrameType::dlcToLength(dlc_ISR);
+        frame.setDataLength(payload_length);
+
+        /* Get the id */
+        frame.id = MB[1] & CAN_WMBn_ID_ID_MASK;
+
+        /* Copy the payload in native 32-bit words, only the words covered by the DLC */
+        std::uint32_t* frame_words = reinterpret_cast<std::uint32_t*>(frame.data);
+        for (std::uint8_t i = 0; i < (payload_length + 3u) >> 2; i++)
+        {
+            frame_words[i] = MB[MB_Data_Offset + i];
+        }
+
+        /* Resolve the frame's 16-bit hardware timestamp, reading the timer unlocks the MB */
+        frame.timestamp = resolve_Timestamp(MB_CS & 0xFFFF, FlexCAN[Instance]->TIMER, time_Ticks());
+    }
+
+    /*
+     * Helper function for applying the admission policy of an interface's RX FIFO to a received frame, it makes
+     * room in the queue and updates the drop counters as needed.
+     * tparam Instance The interface instance number used by the ISR
+     * param  id       The 29-bit CAN ID of the received frame.
+     * return true if the frame can be inserted in the queue.
+     */
+    template <std::uint8_t Instance>
+    static bool admit_Frame(std::uint32_t id)
+    {
+        auto&       ISR_buffer = g_frame_ISRbuffer[Instance];
+        std::size_t free_slots = (ISR_buffer.size() < Frame_Capacity) ? Frame_Capacity - ISR_buffer.size() : 0u;
+        bool        admitted   = false;
+
+        switch (g_admission_policy[Instance])
+        {
+        case AdmissionPolicy::ReservePerClass:
+            /* The frame is admitted only if the slots reserved for the more urgent classes remain free */
+            admitted = free_slots > Priority_Class_Headroom[frame_Priority(id)];
+            if (!admitted && free_slots)
+            {
+                g_reserved_frames_count[Instance]++;
+            }
+            break;
+
+        case AdmissionPolicy::EvictLowestPriority:
+            admitted = free_slots > 0u;
+            if (!admitted)
+            {
+                /* Linear search of the lowest priority queued frame, the one with the greatest CAN ID */
+                auto lowest = ISR_buffer.begin();
+                for (auto it = ISR_buffer.begin(); it != ISR_buffer.end(); it++)
+                {
+                    if (it->priorityLowerThan(*lowest))
+                    {
+                        lowest = it;
+                    }
+                }
+
+                /* Evict it only if the received frame wins arbitration against it */
+                if ((lowest != ISR_buffer.end()) && (id < (lowest->id & FrameType::MaskExtID)))
+                {
+                    ISR_buffer.erase(lowest);
+                    g_evicted_frames_count[Instance]++;
+                    admitted = true;
+                }
+            }
+            break;
+
+        case AdmissionPolicy::DropNewest:
+        default:
+            admitted = free_slots > 0u;
+            break;
+        }
+
+        if (!admitted && !free_slots)
+        {
+            /* Increment the number of discarded frames due to full RX dequeue */
+            g_discarded_frames_count[Instance]++;
+        }
+
+        return admitted;
+    }
+
+    /*
+     * Helper function for finding a transmission MB where a frame can be loaded. The MB's lane must accept the
+     * frame's priority class and, among the eligible ones, the most permissive lane is used so the reserved lanes
+     * stay ready for urgent traffic. The frame's own class is loaded as local priority, not the lane's, so an
+     * urgent frame in a shared lane still wins local arbitration against a less urgent one in a reserved lane. A
+     * frame isn't loaded in a MB that would win internal arbitration against another busy MB holding the same ID,
+     * since it would be transmitted ahead of the frame that precedes it in its transfer.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  id        The 29-bit CAN ID of the frame to load.
+     * return Index of the MB or TX_MB_Count if none is available.
+     */
+    static std::uint8_t transmit_FreeMB(std::uint8_t instance, std::uint32_t id)
+    {
+        std::uint8_t mb_index = TX_MB_Count;
+        std::uint8_t priority = frame_Priority(id);
+
+        for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+        {
+            /* Skip busy MB's and lanes reserved for more urgent classes */
+            if ((g_tx_MB_busy[instance] & (1u << i)) || (g_tx_lane_priority[instance][i] < priority))
+            {
+                continue;
+            }
+
+            /* Skip the MB if it would overtake a busy MB holding the same ID */
+            bool overtakes = false;
+            for (std::uint8_t j = 0; j < TX_MB_Count; j++)
+            {
+                if ((g_tx_MB_busy[instance] & ~(g_tx_MB_pinned[instance] | g_tx_MB_loaned[instance]) & (1u << j)) &&
+                    ((g_tx_MB_frame[instance][j].id & FrameType::MaskExtID) == id) &&
+                    (i < j)) /* Same ID's tie on PRIO, the lowest MB number wins */
+                {
+                    overtakes = true;
+                }
+            }
+
+            /* Prefer the most permissive lane */
+            if (!overtakes && ((mb_index == TX_MB_Count) ||
+                               (g_tx_lane_priority[instance][i] > g_tx_lane_priority[instance][mb_index])))
+            {
+                mb_index = i;
+            }
+        }
+
+        return mb_index;
+    }
+
+    /*
+     * Helper function for requesting the abort of the transmission MB with the lowest priority frame if it has a lower
+     * priority than the given one, following FlexCAN's abort procedure (requires MCR[AEN]): a MB whose interrupt flag
+     * is already set completed and isn't aborted, otherwise the ABORT code is written and the MB is released by
+     * transmit_Reap() once its flag sets, without waiting for it here. A slot of the transmission queue is reserved
+     * for putting the aborted frame back, so only one MB is aborted at a time and none while the queue is full.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  id        The 29-bit CAN ID of the urgent frame.
+     * return true if the abort was requested.
+     */
+    static bool transmit_Preempt(std::uint8_t instance, std::uint32_t id)
+    {
+        if (g_tx_MB_aborting[instance] || transmitQueue_Full(instance))
+        {
+            return false;
+        }
+
+        /* Find the busy MB with the greatest ID whose lane accepts the urgent frame, the one transmitted last among
+         * equal ID's */
+        std::uint8_t  victim    = TX_MB_Count;
+        std::uint32_t victim_id = 0;
+        for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+        {
+            std::uint32_t MB_id = g_tx_MB_frame[instance][i].id & FrameType::MaskExtID;
+            if ((g_tx_MB_busy[instance] &
+                 ~(g_tx_MB_pinned[instance] | g_tx_MB_timed[instance] | g_tx_MB_loaned[instance]) & (1u << i)) &&
+                (g_tx_lane_priority[instance][i] >= frame_Priority(id)) &&
+                (!UAVCAN_DMA_PAYLOAD || (g_dma_TX_MB[instance] != i)) &&
+                ((victim == TX_MB_Count) || (MB_id > victim_id) ||
+                 ((MB_id == victim_id) && (i > victim)))) /* Same ID's tie on PRIO, the highest MB goes last */
+            {
+                victim    = i;
+                victim_id = MB_id;
+            }
+        }
+
+        /* Preempt only if the urgent frame has a higher priority than every loaded MB, and the MB didn't complete */
+        if ((victim == TX_MB_Count) || (id >= victim_id) ||
+            (FlexCAN[instance]->IFLAG1 & (1u << (TX_MB_Base(instance) + victim))))
+        {
+            return false;
+        }
+
+        /* Request the abort by writing the ABORT code into the MB, and keep a slot for its frame */
+        volatile std::uint32_t& MB_CS = FlexCAN[instance]->RAMn[TX_MB_Word(instance, victim)];
+        MB_CS = (MB_CS & ~MB_Code_Mask) | (static_cast<std::uint32_t>(TX_Abort) << MB_Code_Shift);
+
+        g_tx_MB_aborting[instance] |= 1u << victim;
+        g_tx_queue[instance].reserved++;
+        if (transmitQueue_Full(instance))
+        {
+            g_ready_mask &= ~InterfaceGroup::readyTX(instance + 1u);
+        }
+
+        return true;
+    }
+
+    /*
+     * Helper function for releasing the transmission MB's of an interface whose interrupt flag is set. The CODE of a
+     * MB being aborted tells whether it was aborted (ABORT), then its frame is put back in the queue in the slot
+     * reserved for it, or whether it won arbitration before the abort took effect (INACTIVE), then it completed like
+     * the others. Must be called with interrupts disabled, it is used by the ISR and by transmit_Pump().
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * return Bit mask of the MB's released.
+     */
+    static std::uint32_t transmit_Reap(std::uint8_t instance)
+    {
+        /* The pinned MB's are rewritten by the scheduler of the periodic publications */
+        std::uint32_t TX_flags =
+            (FlexCAN[instance]->IFLAG1 >> TX_MB_Base(instance)) & g_tx_MB_busy[instance] & ~g_tx_MB_pinned[instance];
+        std::uint32_t released = TX_flags;
+
+        if (!TX_flags)
+        {
+            return 0;
+        }
+
+        /* Clear their interrupt flags (W1C) */
+        FlexCAN[instance]->IFLAG1 = TX_flags << TX_MB_Base(instance);
+
+        for (std::uint8_t i = 0; (TX_flags & g_tx_MB_aborting[instance]) && (i < TX_MB_Count); i++)
+        {
+            const std::uint32_t flag = 1u << i;
+            if (!(TX_flags & g_tx_MB_aborting[instance] & flag))
+            {
+                continue;
+            }
+
+            g_tx_MB_aborting[instance] &= ~flag;
+            g_tx_queue[instance].reserved--;
+
+            std::uint32_t MB_CS = FlexCAN[instance]->RAMn[TX_MB_Word(instance, i)];
+            if (((MB_CS & MB_Code_Mask) >> MB_Code_Shift) == TX_Abort)
+            {
+                TX_flags &= ~flag;
+                g_tx_MB_busy[instance] &= ~flag;
+                g_preempted_frames_count[instance]++;
+
+                /* A forwarded frame is stashed in FlexCAN's byte order, swap it back for the queue */
+                if (g_tx_MB_forwarded[instance] & flag)
+                {
+                    payload_ByteSwap(g_tx_MB_frame[instance][i]);
+                    g_tx_MB_forwarded[instance] &= ~flag;
+                }
+
+                /* Put the aborted frame back ahead of the frames that follow it in its transfer */
+                if (transmitQueue_Insert(instance, g_tx_MB_frame[instance][i], true))
+                {
+                    g_requeued_frames_count[instance]++;
+                }
+            }
+        }
+
+        if (!transmitQueue_Full(instance))
+        {
+            g_ready_mask |= InterfaceGroup::readyTX(instance + 1u);
+        }
+
+        /* Account the transmitted frames and release their MB's */
+        for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+        {
+            if (TX_flags & (1u << i))
+            {
+                bus_Account(instance, g_tx_MB_frame[instance][i].getDataLength());
+            }
+        }
+        if (TX_flags & g_tx_MB_forwarded[instance])
+        {
+            gateway_Egress(instance, TX_flags);
+        }
+        if (TX_flags & g_tx_MB_timed[instance])
+        {
+            timed_Complete(instance, TX_flags);
+        }
+        g_tx_MB_busy[instance] &= ~TX_flags;
+
+        return released;
+    }
+
+    /*
+     * Helper function for accounting the forwarded frames whose transmission completed, their latency is measured
+     * from their reception timestamp to the completion of their transmission on the egress instance. Must be called
+     * with interrupts disabled.
+     * param  instance  The egress FlexCAN instance number, starts at 0.
+     * param  TX_flags  Bit mask of the transmission MB's that completed.
+     */
+    static void gateway_Egress(std::uint8_t instance, std::uint32_t TX_flags)
+    {
+        std::uint32_t forwarded = TX_flags & g_tx_MB_forwarded[instance];
+        std::uint8_t  ingress   = Gateway_Peer[instance];
+        std::uint64_t now       = time_Ticks() / 80u;
+
+        for (std::uint8_t i = 0; forwarded && (i < TX_MB_Count); i++)
+        {
+            if (forwarded & (1u << i))
+            {
+                std::uint32_t latency = static_cast<std::uint32_t>(now - g_tx_MB_ingress[instance][i]);
+
+                /* Bucket k counts the latencies below 2^(k+3) microseconds, the last one the rest */
+                std::uint8_t bucket = 0;
+                while ((bucket < GatewayLatencyBuckets - 1u) && (latency >= (8u << bucket)))
+                {
+                    bucket++;
+                }
+                g_forward_latency_histogram[ingress][bucket]++;
+
+                if (latency > g_forward_latency_max[ingress])
+                {
+                    g_forward_latency_max[ingress] = latency;
+                }
+            }
+        }
+
+        g_tx_MB_forwarded[instance] &= ~TX_flags;
+    }
+
+    /*
+     * Helper function for forwarding a received frame to the peer instance if it matches a forwarding rule. With the
+     * peer's transmission queue empty, the frame is copied straight into a free transmission MB of the peer keeping
+     * FlexCAN's byte order, otherwise it is inserted in the peer's queue behind any frame of the same ID.
+     * tparam Instance The ingress FlexCAN instance number.
+     * tparam Harvest  Callable with signature void(InterfaceGroup::FrameType&) that fills up a frame object with the
+     *                 received frame, keeping the payload in FlexCAN's byte order.
+     * param  id       The 29-bit CAN ID of the received frame.
+     * param  harvest  The callable that copies the frame.
+     * param  from_ISR True if called with interrupts disabled, otherwise the peer's transmission state is accessed
+     *                 in a critical section.
+     * return true if the frame matched a rule and was consumed by the gateway.
+     */
+    template <std::uint8_t Instance, typename Harvest>
+    static bool gateway_Forward(std::uint32_t id, Harvest& harvest, bool from_ISR)
+    {
+        /* Find the first matching rule */
+        const InterfaceGroup::ForwardRule* rule = nullptr;
+        for (std::uint8_t i = 0; !rule && (i < g_gateway_rule_count[Instance]); i++)
+        {
+            if ((id & g_gateway_rules[Instance][i].mask) ==
+                (g_gateway_rules[Instance][i].id & g_gateway_rules[Instance][i].mask))
+            {
+                rule = &g_gateway_rules[Instance][i];
+            }
+        }
+
+        if (!rule)
+        {
+            return false;
+        }
+
+        constexpr std::uint8_t peer = Gateway_Peer[Instance];
+        const std::uint32_t    egress_id =
+            ((id & ~rule->rewrite_mask) | (rule->rewrite_id & rule->rewrite_mask)) & FrameType::MaskExtID;
+
+        if (!from_ISR)
+        {
+            DISABLE_INTERRUPTS()
+        }
+
+        std::uint8_t mb_index = g_tx_queue[peer].count ? TX_MB_Count : transmit_FreeMB(peer, egress_id);
+
+        if (mb_index < TX_MB_Count)
+        {
+            /* Copy the frame straight into the stash of the peer's free MB and load it without byte swapping */
+            InterfaceGroup::FrameType& frame = g_tx_MB_frame[peer][mb_index];
+            harvest(frame);
+            frame.id = egress_id;
+
+            if (Classic_CAN[peer] && (frame.getDataLength() > Classic_Max_Length))
+            {
+                g_forward_dropped_count[Instance]++;
+            }
+            else
+            {
+                messageBuffer_Transmit(peer, mb_index, frame, false);
+                g_tx_MB_busy[peer] |= 1u << mb_index;
+                g_tx_MB_forwarded[peer] |= 1u << mb_index;
+                g_tx_MB_ingress[peer][mb_index] = frame.timestamp.toMicrosecond();
+                g_forwarded_frames_count[Instance]++;
+            }
+        }
+        else
+        {
+            /* Queue the frame in the application's byte order as any other frame of the peer */
+            InterfaceGroup::FrameType frame;
+            harvest(frame);
+            frame.id = egress_id;
+            payload_ByteSwap(frame);
+
+            if ((!Classic_CAN[peer] || (frame.getDataLength() <= Classic_Max_Length)) &&
+                transmitQueue_Insert(peer, frame, false))
+            {
+                g_forward_queued_count[Instance]++;
+                transmit_Pump(peer);
+            }
+            else
+            {
+                g_forward_dropped_count[Instance]++;
+            }
+        }
+
+        if (!from_ISR)
+        {
+            ENABLE_INTERRUPTS()
+        }
+
+        return true;
+    }
+
+    /*
+     * Helper function for routing a received frame to its destination: the peer instance if it matches a forwarding
+     * rule of the gateway, the callback or the queue of its port if it is registered in the dispatch table, or else
+     * the shared queue if its admission policy accepts it. The frame is only copied once its destination slot is
+     * known.
+     * tparam Instance The interface instance number used by the ISR
+     * tparam Harvest  Callable with signature void(InterfaceGroup::FrameType&) that fills up a frame object with the
+     *                 received frame, keeping the payload in FlexCAN's byte order.
+     * param  id       The 29-bit CAN ID of the received frame.
+     * param  harvest  The callable that copies the frame.
+     * param  from_ISR True if called from the ISR, with interrupts disabled.
+     */
+    template <std::uint8_t Instance, typename Harvest>
+    static void route_Frame(std::uint32_t id, Harvest harvest, bool from_ISR)
+    {
+        /* Frames matching a forwarding rule of the gateway leave through the peer instance instead */
+        if (g_gateway_rule_count[Instance] && gateway_Forward<Instance>(id, harvest, from_ISR))
+        {
+            return;
+        }
+
+        /* Look up the frame's subject or service in the interface's dispatch table */
+        DispatchPort* port = g_dispatch_count[Instance] ? dispatch_Find(Instance, port_Key(id)) : nullptr;
+
+        /* Frames of ports with subscribers are copied once into a shared slot and handed to every subscriber */
+        if (port && port->subscriber_count)
+        {
+            std::uint8_t slot = shared_Acquire();
+
+            if (slot < Shared_Frame_Capacity)
+            {
+                harvest(g_shared_frames[slot].frame);
+                payload_ByteSwap(g_shared_frames[slot].frame);
+
+                /* The ISR's reference is dropped once every subscriber took its own */
+                const InterfaceGroup::FrameRef frame(slot);
+                for (std::uint8_t i = 0; i < port->subscriber_count; i++)
+                {
+                    port->subscribers[i].callback(Instance + 1u, frame, port->subscribers[i].context);
+                }
+            }
+            else
+            {
+                /* Increment the number of discarded frames due to the pool being exhausted */
+                port->discarded++;
+            }
+        }
+
+        /* Frames of ports registered with a callback are handed over from the stack */
+        else if (port && port->callback)
+        {
+            InterfaceGroup::FrameType FrameISR;
+
+            /* Copy the frame out of the message buffer */
+            harvest(FrameISR);
+
+            /* Callbacks receive the payload in little-endian order */
+            payload_ByteSwap(FrameISR);
+            port->callback(Instance + 1u, FrameISR);
+        }
+
+        /* Frames of the other registered ports are queued only if the port's queue isn't full */
+        else if (port)
+        {
+            std::uint8_t next_tail = static_cast<std::uint8_t>((port->tail + 1u) % Port_Frame_Capacity);
+
+            if (next_tail != port->head)
+            {
+                /* Copy the frame directly into the port's free slot */
+                harvest(port->frames[port->tail]);
+
+                /* Publish the slot to readPort() */
+                port->tail = next_tail;
+            }
+            else
+            {
+                /* Increment the number of discarded frames due to full port queue */
+                port->discarded++;
+            }
+        }
+
+        /* Receive a frame only if the admission policy of the shared buffer accepts it */
+        else if (admit_Frame<Instance>(id))
+        {
+            /* Insert a frame into the queue and copy the frame directly into it */
+            g_frame_ISRbuffer[Instance].emplace_back();
+            harvest(g_frame_ISRbuffer[Instance].back());
+            g_ready_mask |= InterfaceGroup::readyRX(Instance + 1u);
+        }
+    }
+
+    /*
+     * Helper function for the top half of a deferred instance, copies the raw contents of a message buffer into the
+     * instance's raw frame ring and pends PendSV for processing it. The MB is unlocked once captured.
+     * tparam Instance The interface instance number used by the ISR
+     * param  MB       Address of the message buffer that received the frame.
+     * param  MB_CS    Control and Status word read when locking the MB.
+     */
+    template <std::uint8_t Instance>
+    static void capture_Frame(volatile std::uint32_t* const MB, std::uint32_t MB_CS)
+    {
+        RawFrameRing& ring      = g_raw_ring[Instance];
+        std::uint8_t  next_tail = static_cast<std::uint8_t>((ring.tail + 1u) % Raw_Frame_Capacity);
+
+        if (next_tail != ring.head)
+        {
+            RawFrame& raw = ring.frames[ring.tail];
+
+            /* Control and Status word, ID and the payload words covered by the DLC */
+            raw.CS = MB_CS;
+            raw.id = MB[1];
+
+            std::uint_fast8_t payload_length = InterfaceGroup::FrameType::dlcToLength(
+                CAN::FrameDLC((raw.CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT));
+            for (std::uint8_t i = 0; i < ((payload_length + 3u) >> 2); i++)
+            {
+                raw.payload[i] = MB[MB_Data_Offset + i];
+            }
+
+            /* Publish the slot to the bottom half */
+            ring.tail = next_tail;
+        }
+        else
+        {
+            /* Increment the number of discarded frames due to full RX buffering */
+            g_discarded_frames_count[Instance]++;
+        }
+
+        /* Unlock the MB */
+        static_cast<void>(FlexCAN[Instance]->TIMER);
+
+        /* Pend the bottom half */
+        S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+    }
+
+public:
+    /*
+     * PendSV bottom half of a deferred instance, processes in a batch every raw frame captured by the ISR. A single
+     * sample of the FlexCAN timer and the LPIT time base resolves the timestamps of the whole batch, then each frame
+     * is byte swapped if needed, dispatched and queued just as the ISR does for the non deferred instances.
+     * tparam Instance The FlexCAN peripheral instance number, starts at 0.
+     */
+    template <std::uint8_t Instance>
+    static void S32K_libuavcan_bottom_half()
+    {
+        static_assert(Instance < CANFD_Count, "FlexCAN instance not available in the target MCU");
+
+        RawFrameRing& ring = g_raw_ring[Instance];
+
+        if (!Deferred_RX[Instance] || (ring.head == ring.tail))
+        {
+            return;
+        }
+
+        /* Sample both time bases together for the whole batch */
+        DISABLE_INTERRUPTS()
+        std::uint64_t FlexCAN_timestamp = FlexCAN[Instance]->TIMER;
+        std::uint64_t target_source     = time_Ticks();
+        ENABLE_INTERRUPTS()
+
+        while (ring.head != ring.tail)
+        {
+            const RawFrame& raw = ring.frames[ring.head];
+
+            auto harvest = [&](InterfaceGroup::FrameType& frame) {
+                std::uint_fast8_t payload_length = InterfaceGroup::FrameType::dlcToLength(
+                    CAN::FrameDLC((raw.CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT));
+                frame.setDataLength(payload_length);
+                frame.id = raw.id & CAN_WMBn_ID_ID_MASK;
+                std::copy(raw.payload, raw.payload + ((payload_length + 3u) >> 2),
+                          reinterpret_cast<std::uint32_t*>(frame.data));
+                frame.timestamp = resolve_Timestamp(raw.CS & 0xFFFF, FlexCAN_timestamp, target_source);
+            };
+            route_Frame<Instance>(raw.id & CAN_WMBn_ID_ID_MASK, harvest, false);
+
+            /* Release the slot back to the ISR */
+            ring.head = static_cast<std::uint8_t>((ring.head + 1u) % Raw_Frame_Capacity);
+        }
+    }
+
+    /*
+     * Helper function for copying a received frame out of a message buffer straight into a caller's frame from the
+     * polling path of read(), the payload's byte swap is fused with the copy. The MB is locked for the copy and
+     * unlocked afterwards. Must be called with interrupts disabled, the ISR reads Control and Status words and the
+     * timer of the instance, which would unlock the MB in the middle of the copy.
+     * param  instance The FlexCAN instance number, starts at 0.
+     * param  MB       Address of the message buffer that received the frame.
+     * param  frame    Frame object where the message buffer is copied to, the payload ends in little-endian order.
+     * return true if a complete frame was copied, false if the MB didn't hold one.
+     */
+    static bool poll_Frame(std::uint8_t instance, volatile std::uint32_t* const MB, InterfaceGroup::FrameType& frame)
+    {
+        /* Lock the message buffer reading its Control and Status word a single time */
+        const std::uint32_t MB_CS = lock_MB(MB);
+
+        if (!MB_Holds_Frame(instance, MB_CS))
+        {
+            /* Unlock the MB */
+            static_cast<void>(FlexCAN[instance]->TIMER);
+            return false;
+        }
+
+        /* Payload length in bytes for the received DLC */
+        std::uint_fast8_t payload_length = InterfaceGroup::FrameType::dlcToLength(
+            CAN::FrameDLC((MB_CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT));
+        frame.setDataLength(payload_length);
+
+        /* Get the id */
+        frame.id = MB[1] & CAN_WMBn_ID_ID_MASK;
+
+        /* Copy and byte swap the payload in native 32-bit words, only the words covered by the DLC */
+        std::uint32_t* frame_words = reinterpret_cast<std::uint32_t*>(frame.data);
+        for (std::uint8_t i = 0; i < (payload_length + 3u) >> 2; i++)
+        {
+            std::uint32_t MB_word = MB[MB_Data_Offset + i];
+            REV_BYTES_32(MB_word, frame_words[i]);
+        }
+
+        /* Resolve the frame's 16-bit hardware timestamp, reading the timer unlocks the MB */
+        frame.timestamp = resolve_Timestamp(MB_CS & 0xFFFF, FlexCAN[instance]->TIMER, time_Ticks());
+
+        return true;
+    }
+
+    /*
+     * Helper function for the ring slot the eDMA reception channel of a classic instance writes next, a slot being
+     * written counts as not written yet.
+     * param  instance The FlexCAN instance number, starts at 0.
+     * return Index of the slot.
+     */
+    static std::uint8_t classic_Slot(std::uint8_t instance)
+    {
+        return static_cast<std::uint8_t>(
+            (DMA->TCD[DMA_RX_Channel[instance]].DADDR -
+             static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(g_classic_ring[instance]))) /
+            sizeof(ClassicFrame));
+    }
+
+    /*
+     * Helper function for reading the next frame from the eDMA ring of a classic instance, with the timestamp resolved
+     * by the channel's interrupt at the frame's reception.
+     * param  instance The FlexCAN instance number, starts at 0.
+     * param  frame    Frame object where the ring's frame is copied to, the payload ends in little-endian order.
+     * return true if a frame was read, false if the ring is empty.
+     */
+    static bool classic_Read(std::uint8_t instance, InterfaceGroup::FrameType& frame)
+    {
+        /* The channel's interrupt moves the head along when the ring overflows */
+        DISABLE_INTERRUPTS()
+
+        const std::uint32_t head = g_classic_head[instance];
+        if (head == g_classic_tail[instance])
+        {
+            ENABLE_INTERRUPTS()
+            return false;
+        }
+
+        const std::size_t            slot    = head % Classic_Ring_Capacity;
+        const volatile ClassicFrame& classic = g_classic_ring[instance][slot];
+
+        /* Payload length in bytes for the received DLC, capped at 8 bytes for classic frames */
+        std::uint_fast8_t payload_length = std::min<std::uint_fast8_t>(
+            (classic.CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT, Classic_Max_Length);
+        frame.setDataLength(payload_length);
+
+        /* Get the id, copy and byte swap the payload */
+        frame.id                   = classic.id & CAN_WMBn_ID_ID_MASK;
+        std::uint32_t* frame_words = reinterpret_cast<std::uint32_t*>(frame.data);
+        for (std::uint8_t i = 0; i < 2u; i++)
+        {
+            REV_BYTES_32(classic.payload[i], frame_words[i]);
+        }
+
+        frame.timestamp          = time::Monotonic::fromMicrosecond(g_classic_stamp[instance][slot]);
+        g_classic_head[instance] = head + 1u;
+
+        ENABLE_INTERRUPTS()
+
+        return true;
+    }
+
+    /*
+     * Move frames from an interface's transmission queue into its free transmission MB's, highest priority first,
+     * preempting a loaded MB if enabled. Must be called with interrupts disabled, it is used both from write() and
+     * from the ISR when a transmission completes.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     */
+    static void transmit_Pump(std::uint8_t instance)
+    {
+        TransmitQueue& queue = g_tx_queue[instance];
+
+        while (queue.count)
+        {
+            std::uint32_t id       = queue.frames[0].id & FrameType::MaskExtID;
+            std::uint8_t  mb_index = transmit_FreeMB(instance, id);
+
+            if (mb_index == TX_MB_Count)
+            {
+                /* Every MB is busy, release the ones that completed since the last interrupt */
+                if (transmit_Reap(instance))
+                {
+                    continue;
+                }
+
+                /* Else request the abort of the one with the lowest priority, the ISR releases it and pumps again */
+                if (g_tx_preemption[instance])
+                {
+                    static_cast<void>(transmit_Preempt(instance, id));
+                }
+                break;
+            }
+
+            /* Keep a copy of the frame for the case it gets aborted, and request its transmission */
+            g_tx_MB_frame[instance][mb_index] = queue.frames[0];
+            messageBuffer_Transmit(instance, mb_index, g_tx_MB_frame[instance][mb_index]);
+            g_tx_MB_busy[instance] |= 1u << mb_index;
+
+            transmitQueue_Pop(instance);
+        }
+    }
+
+    /*
+     * Helper function for checking whether the frame serialized in a loaned MB would be loaded right into it: the MB
+     * would be chosen for the frame and the frame goes before every queued frame. Must be called with interrupts
+     * disabled, the MB is only released for the check.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  MB_index  The loaned MB.
+     * return true if the frame would be loaded into the MB, false if it would go through the transmission queue.
+     */
+    static bool loaned_Direct(std::uint8_t instance, std::uint8_t MB_index)
+    {
+        const TransmitQueue& queue  = g_tx_queue[instance];
+        const std::uint32_t  id     = g_tx_MB_frame[instance][MB_index].id & FrameType::MaskExtID;
+        const std::uint32_t  flag   = 1u << MB_index;
+        const std::uint32_t  busy   = g_tx_MB_busy[instance];
+        const std::uint32_t  loaned = g_tx_MB_loaned[instance];
+
+        g_tx_MB_busy[instance]   = busy & ~flag;
+        g_tx_MB_loaned[instance] = loaned & ~flag;
+
+        const bool first  = !queue.count || (id < (queue.frames[0].id & FrameType::MaskExtID));
+        const bool direct = first && (transmit_FreeMB(instance, id) == MB_index);
+
+        g_tx_MB_busy[instance]   = busy;
+        g_tx_MB_loaned[instance] = loaned;
+
+        return direct;
+    }
+
+    /*
+     * Request the transmission of a frame serialized in place in the frame copy of a loaned MB. The frame is loaded
+     * right into the MB if loaned_Direct(), otherwise it is inserted in the transmission queue and the MB is released
+     * to it. Must be called with interrupts disabled.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  MB_index  The loaned MB.
+     * return true if the frame was loaded or queued, false if the queue is full, the MB stays loaned then.
+     */
+    static bool transmit_Loaned(std::uint8_t instance, std::uint8_t MB_index)
+    {
+        FrameType&          frame  = g_tx_MB_frame[instance][MB_index];
+        const std::uint32_t flag   = 1u << MB_index;
+        const bool          direct = loaned_Direct(instance, MB_index);
+
+        if (!direct && transmitQueue_Full(instance))
+        {
+            return false;
+        }
+
+        g_tx_MB_busy[instance] &= ~flag;
+        g_tx_MB_loaned[instance] &= ~flag;
+
+        if (direct)
+        {
+            messageBuffer_Transmit(instance, MB_index, frame);
+            g_tx_MB_busy[instance] |= flag;
+        }
+        else
+        {
+            static_cast<void>(transmitQueue_Insert(instance, frame, false));
+            transmit_Pump(instance);
+        }
+
+        return true;
+    }
+
+    /*
+     * Helper function for loading a periodic publication into its pinned MB, which must be inactive. Only the payload
+     * words patched since the previous period are rewritten, besides the Control and Status word that requests the
+     * transmission, the ID word stays from when the MB was pinned.
+     * param  publication  The publication to load.
+     */
+    static void publication_Load(Publication& publication)
+    {
+        const std::uint8_t   instance = publication.instance;
+        const std::uint16_t  MB_word  = TX_MB_Word(instance, publication.MB);
+        const std::uint32_t* native_FrameData =
+            reinterpret_cast<const std::uint32_t*>(static_cast<const std::uint8_t*>(publication.frame.data));
+        const std::uint8_t payload_words = static_cast<std::uint8_t>((publication.frame.getDataLength() + 3u) >> 2);
+
+        for (std::uint8_t i = 0; i < payload_words; i++)
+        {
+            if (publication.dirty & (1u << i))
+            {
+                REV_BYTES_32(native_FrameData[i], FlexCAN[instance]->RAMn[MB_word + MB_Data_Offset + i]);
+            }
+        }
+        publication.dirty = 0;
+
+        FlexCAN[instance]->RAMn[MB_word] = TX_MB_CS(instance, publication.frame);
+    }
+
+    /*
+     * Helper function for publishing a periodic publication once, through its pinned MB or else through the
+     * transmission queue. A pinned MB still pending from the previous period is left alone and the period skipped.
+     * param  publication  The publication to publish.
+     */
+    static void publication_Publish(Publication& publication)
+    {
+        const std::uint8_t instance = publication.instance;
+
+        if (publication.MB < TX_MB_Count)
+        {
+            volatile std::uint32_t& MB_CS = FlexCAN[instance]->RAMn[TX_MB_Word(instance, publication.MB)];
+            const std::uint32_t     flag  = 1u << (TX_MB_Base(instance) + publication.MB);
+
+            if (((MB_CS & MB_Code_Mask) >> MB_Code_Shift) == TX_Data)
+            {
+                publication.skipped++;
+                return;
+            }
+
+            /* The pinned MB doesn't interrupt, its previous transmission is accounted here */
+            if (FlexCAN[instance]->IFLAG1 & flag)
+            {
+                FlexCAN[instance]->IFLAG1 = flag;
+                bus_Account(instance, publication.frame.getDataLength());
+            }
+
+            publication_Load(publication);
+            publication.published++;
+        }
+        else if (transmitQueue_Insert(instance, publication.frame, false))
+        {
+            transmit_Pump(instance);
+            publication.published++;
+        }
+        else
+        {
+            publication.skipped++;
+        }
+    }
+
+    /*
+     * Helper function for preloading a time-triggered frame into a free transmission MB, left inactive so it doesn't
+     * enter arbitration until its Control and Status word is written at the target. The MB is kept busy meanwhile.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  entry     Index of the frame in the instance's calendar.
+     * return true if the frame was preloaded, false if every transmission MB is busy.
+     */
+    static bool timed_Load(std::uint8_t instance, std::uint8_t entry)
+    {
+        TimedFrame&  timed    = g_calendar[instance][entry];
+        std::uint8_t mb_index = TX_MB_Count;
+
+        for (std::uint8_t i = 0; (mb_index == TX_MB_Count) && (i < TX_MB_Count); i++)
+        {
+            mb_index = (g_tx_MB_busy[instance] & (1u << i)) ? mb_index : i;
+        }
+
+        if (mb_index == TX_MB_Count)
+        {
+            return false;
+        }
+
+        /* Deactivate the MB, its CODE may still be ABORT, and write the payload and ID words */
+        volatile std::uint32_t* const MB = &FlexCAN[instance]->RAMn[TX_MB_Word(instance, mb_index)];
+        MB[0] = static_cast<std::uint32_t>(TX_Inactive) << MB_Code_Shift;
+        const std::uint32_t* native_FrameData =
+            reinterpret_cast<const std::uint32_t*>(static_cast<const std::uint8_t*>(timed.frame.data));
+        for (std::uint8_t i = 0; i < ((timed.frame.getDataLength() + 3u) >> 2); i++)
+        {
+            REV_BYTES_32(native_FrameData[i], MB[MB_Data_Offset + i]);
+        }
+        MB[1] = (timed.frame.id & CAN_WMBn_ID_ID_MASK) |
+                (static_cast<std::uint32_t>(frame_Priority(timed.frame.id)) << MB_Prio_Shift);
+
+        /* The frame's copy is accounted by the transmission ISR like any other */
+        g_tx_MB_frame[instance][mb_index]       = timed.frame;
+        g_tx_MB_timed_entry[instance][mb_index] = entry;
+        g_tx_MB_timed[instance] |= 1u << mb_index;
+        g_tx_MB_busy[instance] |= 1u << mb_index;
+
+        timed.MB    = mb_index;
+        timed.state = Timed_Loaded;
+
+        return true;
+    }
+
+    /*
+     * Helper function for advancing the time-triggered frames of every calendar, preloading the ones whose target is
+     * near and activating the preloaded ones whose target arrived, a frame without a MB at its target is missed.
+     * param  now  The current time in ticks of the time base.
+     */
+    static void calendar_Service(std::uint64_t now)
+    {
+        for (std::uint8_t i = 0; i < CANFD_Count; i++)
+        {
+            for (std::uint8_t j = 0; j < CalendarLength; j++)
+            {
+                TimedFrame& timed = g_calendar[i][j];
+
+                if ((timed.state == Timed_Scheduled) && ((now + Timed_Preload_Lead) >= timed.target))
+                {
+                    if (!timed_Load(i, j) && (now >= timed.target))
+                    {
+                        timed.state = Timed_Missed;
+                    }
+                }
+
+                if ((timed.state == Timed_Loaded) && (now >= timed.target))
+                {
+                    FlexCAN[i]->RAMn[TX_MB_Word(i, timed.MB)] = TX_MB_CS(i, timed.frame);
+                    timed.state                                = Timed_Active;
+                }
+            }
+        }
+    }
+
+    /*
+     * Helper function for recording the timestamps of the time-triggered frames whose transmission completed, the
+     * timestamp FlexCAN captures in a transmission MB is resolved against the time base like a received frame's.
+     * param  instance  The FlexCAN instance number, starts at 0.
+     * param  TX_flags  Bit mask of the transmission MB's that completed.
+     */
+    static void timed_Complete(std::uint8_t instance, std::uint32_t TX_flags)
+    {
+        for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+        {
+            if (TX_flags & g_tx_MB_timed[instance] & (1u << i))
+            {
+                TimedFrame&   timed = g_calendar[instance][g_tx_MB_timed_entry[instance][i]];
+                std::uint32_t MB_CS = FlexCAN[instance]->RAMn[TX_MB_Word(instance, i)];
+
+                timed.sof   = resolve_Timestamp(MB_CS & 0xFFFF, FlexCAN[instance]->TIMER, time_Ticks()).toMicrosecond();
+                timed.state = Timed_Sent;
+            }
+        }
+
+        g_tx_MB_timed[instance] &= ~TX_flags;
+    }
+
+    /*
+     * LPIT channel 3 ISR, publishes the periodic publications that are due, preloads and activates the time-triggered
+     * frames and arms the channel for the next event.
+     * The periods are kept from the due times instead of the ISR's latency so they don't drift, the periods missed
+     * altogether are counted as skipped.
+     */
+    static void publication_ISR_handler()
+    {
+        /* Perform the ISR atomically */
+        DISABLE_INTERRUPTS()
+
+        /* Clear the channel's interrupt flag (W1C) */
+        LPIT0->MSR = LPIT_MSR_TIF3_MASK;
+
+        const std::uint64_t now = time_Ticks();
+
+        for (std::uint8_t i = 0; i < MaxPublications; i++)
+        {
+            Publication& publication = g_publications[i];
+
+            if (publication.period && (publication.due <= now))
+            {
+                publication_Publish(publication);
+
+                std::uint64_t missed = (now - publication.due) / publication.period;
+                publication.skipped += static_cast<std::uint32_t>(missed);
+                publication.due += (missed + 1u) * publication.period;
+            }
+        }
+
+        calendar_Service(now);
+        storm_Service(now);
+        scheduler_Arm(now);
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /*
+     * FlexCAN ISR for frame reception, implements a workaround to the S32K1 FlexCAN's lack of a RX FIFO neither a DMA
+     * triggering mechanism for CAN-FD frames in hardware, every flagged RX MB is serviced in a single entry.
+     * It also releases the transmission MB's that completed and refills them from the transmission queue.
+     * The body is specialized at compile time for each instance, so the peripheral's base address and the address of
+     * its reception queue are folded into constants instead of being indexed from the lookup tables on every access.
+     * tparam Instance The FlexCAN peripheral instance number in which the ISR will be executed, starts at 0.
+     *                 differing form this library's interface indexes that start at 1.
+     */
+    template <std::uint8_t Instance>
+    static void S32K_libuavcan_ISR_handler()
+    {
+        static_assert(Instance < CANFD_Count, "FlexCAN instance not available in the target MCU");
+        static_assert(!Deferred_RX[Instance] || UAVCAN_DEFERRED_RX, "Deferred reception requires UAVCAN_DEFERRED_RX");
+
+        /* Constant base address of the instance's peripheral */
+        CAN_Type* const FlexCAN_base = FlexCAN[Instance];
+
+        /* Perform the ISR atomically */
+        DISABLE_INTERRUPTS()
+
+        /* Release the transmission MB's that completed or were aborted since the last interrupt */
+        const std::uint32_t TX_flags = transmit_Reap(Instance);
+
+        /* Move the frames submitted from any context into the queue, then load the next queued frames */
+        const bool submitted = submit_Drain(Instance);
+        if (TX_flags || submitted)
+        {
+            transmit_Pump(Instance);
+        }
+
+        /* RX MB's that received, (0b1111100) mask for 2nd-6th MB, the ones masked by the polling mode are left for
+         * read() */
+        std::uint32_t RX_flags =
+            Classic_CAN[Instance] ? 0u : (FlexCAN_base->IFLAG1 & FlexCAN_base->IMASK1 & RX_MB_Mask);
+
+        /* The RX FIFO of a classic instance is drained by eDMA, only its overflows are handled here */
+        if (Classic_CAN[Instance] && (FlexCAN_base->IFLAG1 & Classic_FIFO_Overflow_Mask))
+        {
+            FlexCAN_base->IFLAG1 = Classic_FIFO_Overflow_Mask;
+            g_overrun_frames_count[Instance]++;
+        }
+
+        /* Time the frames are counted at by the storm protection, once per entry */
+        const std::uint64_t storm_now = (RX_flags && g_storm_max_frames[Instance]) ? time_Ticks() : 0u;
+
+        /* Drain every flagged MB oldest frame first, so a burst spilled across the MB's of a filter group is
+         * delivered in arrival order */
+        while (RX_flags)
+        {
+            std::uint8_t MB_index = oldest_MB(FlexCAN_base, RX_flags);
+
+            /* Address of the message buffer that received, the words are read once through this pointer */
+            volatile std::uint32_t* const MB = &(FlexCAN_base->RAMn[MB_index * MB_Size_Words]);
+
+            /* Lock the MB, its ID and payload are copied before the timer is read to unlock it */
+            const std::uint32_t MB_CS = lock_MB(MB);
+
+            /* Check the MB's code once, its overruns and torn frames are counted by the check */
+            const bool holds_frame = MB_Holds_Frame(Instance, MB_CS);
+
+            if (holds_frame)
+            {
+                /* Account the frame in the bus load */
+                bus_Account(Instance, InterfaceGroup::FrameType::dlcToLength(
+                                          CAN::FrameDLC((MB_CS & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT)));
+
+                /* Count the frame in its filter's hits for the filter tuning, before the MB is unlocked */
+                if (g_tuner[Instance].epoch)
+                {
+                    tuning_Count(Instance, MB_index, MB[1] & CAN_WMBn_ID_ID_MASK);
+                }
+            }
+
+            if (!holds_frame)
+            {
+                /* Discard the torn frame and unlock the MB */
+                static_cast<void>(FlexCAN_base->TIMER);
+            }
+            else if (Deferred_RX[Instance])
+            {
+                /* Only capture the raw frame and leave the rest of the work to the PendSV bottom half */
+                capture_Frame<Instance>(MB, MB_CS);
+            }
+            else
+            {
+                /* Dispatch the frame copying the message buffer directly into its destination */
+                bool unlocked = false;
+                auto harvest  = [MB, MB_CS, &unlocked](InterfaceGroup::FrameType& frame) {
+                    harvest_Frame<Instance>(MB, MB_CS, frame);
+                    unlocked = true;
+                };
+                route_Frame<Instance>(MB[1] & CAN_WMBn_ID_ID_MASK, harvest, true);
+
+                /* Unlock the MB if the frame was discarded without being copied */
+                if (!unlocked)
+                {
+                    static_cast<void>(FlexCAN_base->TIMER);
+                }
+            }
+
+            /* Clear MB interrupt flag (write 1 to clear), only the flag of this MB is written so the flags of other
+             * message buffers that may have been set meanwhile are not cleared */
+            FlexCAN_base->IFLAG1 = (1u << MB_index);
+            RX_flags &= ~(1u << MB_index);
+
+            /* A filter masked by the storm protection leaves its flagged MB's for the end of its back-off */
+            if (g_storm_max_frames[Instance])
+            {
+                RX_flags &= ~storm_Count(Instance, MB_index, storm_now);
+            }
+        }
+
+        /* Enable interrupts back */
+        ENABLE_INTERRUPTS()
+    }
+
+    /*
+     * eDMA completion interrupt of an instance's transmission channel, requests the transmission of the MB whose
+     * payload was copied by writing its Control and Status word.
+     * tparam Instance The FlexCAN peripheral instance number, starts at 0.
+     */
+    template <std::uint8_t Instance>
+    static void DMA_TX_ISR_handler()
+    {
+        DISABLE_INTERRUPTS()
+
+        /* Clear the channel's interrupt request */
+        DMA->CINT = DMA_CINT_CINT(DMA_TX_Channel[Instance]);
+
+        /* Activate the MB */
+        FlexCAN[Instance]->RAMn[TX_MB_Word(Instance, g_dma_TX_MB[Instance])] = g_dma_TX_CS[Instance];
+        g_dma_TX_MB[Instance]                                                 = TX_MB_Count;
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /*
+     * eDMA major loop interrupt of a classic instance's reception channel, one per frame copied into the ring. The
+     * new frames are stamped while their 16-bit timestamps are within a period of the FlexCAN timer and counted in
+     * the ring's tail. The ring keeps a free slot ahead of the eDMA writes, so the frame read by read() is never
+     * overwritten under it: when the ring fills up its oldest frames are dropped and counted as overruns.
+     * tparam Instance The FlexCAN peripheral instance number, starts at 0.
+     */
+    template <std::uint8_t Instance>
+    static void DMA_RX_ISR_handler()
+    {
+        DISABLE_INTERRUPTS()
+
+        /* Clear the channel's interrupt request */
+        DMA->CINT = DMA_CINT_CINT(DMA_RX_Channel[Instance]);
+
+        /* Frames written since the last interrupt, several if it was held off while more frames arrived */
+        std::uint32_t       tail    = g_classic_tail[Instance];
+        const std::uint32_t written = (classic_Slot(Instance) - tail) % Classic_Ring_Capacity;
+
+        /* Stamp them against a single sample of both time bases */
+        const std::uint64_t FlexCAN_timestamp = FlexCAN[Instance]->TIMER;
+        const std::uint64_t target_source     = time_Ticks();
+        for (std::uint32_t i = 0; i < written; i++, tail++)
+        {
+            const std::size_t slot = tail % Classic_Ring_Capacity;
+            g_classic_stamp[Instance][slot] =
+                resolve_Timestamp(g_classic_ring[Instance][slot].CS & 0xFFFF, FlexCAN_timestamp, target_source)
+                    .toMicrosecond();
+        }
+        g_classic_tail[Instance] = tail;
+
+        /* Drop the oldest frames once the slot written next would be the one read next */
+        const std::uint32_t pending = tail - g_classic_head[Instance];
+        if (pending > Classic_Ring_Slack)
+        {
+            g_overrun_frames_count[Instance] += pending - Classic_Ring_Slack;
+            g_classic_head[Instance] = tail - Classic_Ring_Slack;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+};
+
+Result InterfaceGroup::messageBuffer_Transmit(std::uint_fast8_t iface_index,
+                                              std::uint8_t      TX_MB_index,
+                                              const FrameType&  frame,
+                                              bool              payload_swap)
+{
+    /* Get data length of the frame wanted to be transmitted */
+    std::uint_fast8_t payloadLength = frame.getDataLength();
+
+    /* Casting from uint8 to native uint32 for faster payload transfer to transmission message buffer */
+    std::uint32_t* native_FrameData = reinterpret_cast<std::uint32_t*>(const_cast<std::uint8_t*>(frame.data));
+
+    /* Number of payload words, including the bytes that don't add up to a full word e.g. 1,2,3,5,6,7 byte data
+     * length payloads */
+    std::uint8_t payload_words = static_cast<std::uint8_t>((payloadLength + 3u) >> 2);
+
+    /* Offload a long payload to eDMA if its channel is free, the frame must outlive the transfer */
+    bool DMA_copy = UAVCAN_DMA_PAYLOAD && (payload_words >= DMA_Min_Payload_Words) &&
+                    (g_dma_TX_MB[iface_index] == TX_MB_Count);
+
+    if (DMA_copy)
+    {
+        /* FlexCAN natively transmits the bytes in big-endian order, eDMA copies each word byte swapped */
+        dma_Start(DMA_TX_Channel[iface_index], native_FrameData,
+                  &FlexCAN[iface_index]->RAMn[TX_MB_Word(iface_index, TX_MB_index) + MB_Data_Offset], payload_words,
+                  payload_swap);
+    }
+    else if (!payload_swap)
+    {
+        /* The payload is already in FlexCAN's byte order */
+        std::copy(native_FrameData, native_FrameData + payload_words,
+                  &FlexCAN[iface_index]->RAMn[TX_MB_Word(iface_index, TX_MB_index) + MB_Data_Offset]);
+    }
+    else
+    {
+        for (std::uint8_t i = 0; i < payload_words; i++)
+        {
+            /* FlexCAN natively transmits the bytes in big-endian order, in order to transmit little-endian for
+             * UAVCAN, a byte swap is required */
+            REV_BYTES_32(native_FrameData[i],
+                         FlexCAN[iface_index]->RAMn[TX_MB_Word(iface_index, TX_MB_index) + MB_Data_Offset + i]);
+        }
+    }
+
+    /* Fill up frame ID along with its priority class as local priority */
+    FlexCAN[iface_index]->RAMn[TX_MB_Word(iface_index, TX_MB_index) + 1] =
+        (frame.id & CAN_WMBn_ID_ID_MASK) | (static_cast<std::uint32_t>(frame_Priority(frame.id)) << MB_Prio_Shift);
+
+    /* Fill up word 0 of frame and transmit it */
+    const std::uint32_t MB_CS = TX_MB_CS(static_cast<std::uint8_t>(iface_index), frame);
+
+    if (DMA_copy)
+    {
+        /* The eDMA completion interrupt writes the word once the payload is in place */
+        g_dma_TX_CS[iface_index] = MB_CS;
+        g_dma_TX_MB[iface_index] = TX_MB_index;
+    }
+    else
+    {
+        FlexCAN[iface_index]->RAMn[TX_MB_Word(iface_index, TX_MB_index)] = MB_CS;
+    }
+
+    /* After a succesful transmission the interrupt flag of the corresponding message buffer is set, which is
+     * handled by the ISR */
+
+    /* Return successful transmission request status */
+    return Result::Success;
+}
+
+std::uint_fast8_t InterfaceGroup::getInterfaceCount() const
+{
+    return CANFD_Count;
+}
+
+Result InterfaceGroup::write(std::uint_fast8_t interface_index,
+                             const FrameType (&frames)[TxFramesLen],
+                             std::size_t  frames_len,
+                             std::size_t& out_frames_written)
+{
+    /* Initialize return value status */
+    Result Status      = Result::Success;
+    out_frames_written = 0;
+
+    /* Input validation */
+    if ((frames_len > TxFramesLen) || (interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    /* Classic instances only transmit frames of up to 8 bytes */
+    for (std::size_t i = 0; isSuccess(Status) && Classic_CAN[interface_index - 1] && (i < frames_len); i++)
+    {
+        if (frames[i].getDataLength() > Classic_Max_Length)
+        {
+            Status = Result::BadArgument;
+        }
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The queue is shared with the ISR that drains it */
+        DISABLE_INTERRUPTS()
+
+        /* Insert the frames in the transmission queue until it gets full or a frame exceeds its rate limit */
+        while ((out_frames_written < frames_len) && !transmitQueue_Full(instance) &&
+               rate_Admit(instance, frames[out_frames_written]) &&
+               transmitQueue_Insert(instance, frames[out_frames_written], false))
+        {
+            out_frames_written++;
+        }
+
+        /* Load the highest priority frames into the free transmission MB's */
+        FlexCAN_interrupt::transmit_Pump(instance);
+
+        ENABLE_INTERRUPTS()
+
+        if (out_frames_written < frames_len)
+        {
+            Status = out_frames_written ? Result::SuccessPartial : Result::BufferFull;
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::read(std::uint_fast8_t interface_index,
+                            FrameType (&out_frames)[RxFramesLen],
+                            std::size_t& out_frames_read)
+{
+    /* Initialize return value and out_frames_read output reference value */
+    Result Status   = Result::SuccessNothing;
+    out_frames_read = 0;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    /* The head frame left by readMerged() goes before the frames still queued, unless it exceeded the maximum frame
+     * age meanwhile */
+    if (isSuccess(Status) && g_merge_pending[interface_index - 1])
+    {
+        const std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        DISABLE_INTERRUPTS()
+        if (frame_Expired(instance, g_merge_head[instance], time_Ticks() / 80u))
+        {
+            g_expired_frames_count[instance]++;
+        }
+        else
+        {
+            out_frames[0]   = g_merge_head[instance];
+            out_frames_read = RxFramesLen;
+            Status          = Result::Success;
+        }
+        g_merge_pending[instance] = false;
+        if (g_frame_ISRbuffer[instance].empty())
+        {
+            g_ready_mask &= ~readyRX(interface_index);
+        }
+        ENABLE_INTERRUPTS()
+    }
+
+    if (Status == Result::SuccessNothing)
+    {
+        /* Discard the frames at the front of the ISR buffer that exceeded the maximum frame age, if enabled */
+        if (g_max_frame_age[interface_index - 1])
+        {
+            std::uint64_t now = time_Ticks() / 80u;
+
+            DISABLE_INTERRUPTS()
+            while (!g_frame_ISRbuffer[interface_index - 1].empty() &&
+                   ((now - g_frame_ISRbuffer[interface_index - 1].front().timestamp.toMicrosecond()) >
+                    g_max_frame_age[interface_index - 1]))
+            {
+                g_frame_ISRbuffer[interface_index - 1].pop_front();
+                g_expired_frames_count[interface_index - 1]++;
+            }
+            if (g_frame_ISRbuffer[interface_index - 1].empty())
+            {
+                g_ready_mask &= ~readyRX(interface_index);
+            }
+            ENABLE_INTERRUPTS()
+        }
+
+        /* Classic instances are read from their eDMA ring */
+        if (Classic_CAN[interface_index - 1])
+        {
+            if (FlexCAN_interrupt::classic_Read(static_cast<std::uint8_t>(interface_index - 1), out_frames[0]))
+            {
+                bus_Account(static_cast<std::uint8_t>(interface_index - 1), out_frames[0].getDataLength());
+                out_frames_read = RxFramesLen;
+                Status          = Result::Success;
+            }
+        }
+
+        /* In polling mode drain a ready RX MB straight into the caller's frame, once any frame queued before the
+         * mode was entered has been read */
+        else if (g_rx_polling[interface_index - 1] && g_frame_ISRbuffer[interface_index - 1].empty())
+        {
+            std::uint8_t  instance = static_cast<std::uint8_t>(interface_index - 1);
+            std::uint32_t RX_flags = FlexCAN[instance]->IFLAG1 & RX_MB_Mask;
+
+            if (RX_flags)
+            {
+                /* The lock sequence can't be preempted by the transmission path of the ISR */
+                DISABLE_INTERRUPTS()
+
+                /* RX MB that holds the oldest frame */
+                std::uint8_t MB_index = oldest_MB(FlexCAN[instance], RX_flags);
+
+                bool copied = FlexCAN_interrupt::poll_Frame(
+                    instance, &(FlexCAN[instance]->RAMn[MB_index * MB_Size_Words]), out_frames[0]);
+                if (copied)
+                {
+                    bus_Account(instance, out_frames[0].getDataLength());
+                }
+
+                /* Clear MB interrupt flag (write 1 to clear), this releases the MB for the next frame */
+                FlexCAN[instance]->IFLAG1 = (1u << MB_index);
+
+                ENABLE_INTERRUPTS()
+
+                /* Default RX number of frames read at once by this implementation is 1 */
+                if (copied)
+                {
+                    out_frames_read = RxFramesLen;
+                    Status          = Result::Success;
+                }
+            }
+        }
+
+        /* Check if the ISR buffer isn't empty */
+        else if (!g_frame_ISRbuffer[interface_index - 1].empty())
+        {
+            /* The queue is shared with the ISR and the PendSV bottom half that fill it */
+            DISABLE_INTERRUPTS()
+
+            /* Get the front element of the queue buffer */
+            out_frames[0] = g_frame_ISRbuffer[interface_index - 1].front();
+
+            /* Pop the front element of the queue buffer */
+            g_frame_ISRbuffer[interface_index - 1].pop_front();
+            if (g_frame_ISRbuffer[interface_index - 1].empty())
+            {
+                g_ready_mask &= ~readyRX(interface_index);
+            }
+
+            ENABLE_INTERRUPTS()
+
+            /* Perform byte swap */
+            payload_ByteSwap(out_frames[0]);
+
+            /* Default RX number of frames read at once by this implementation is 1 */
+            out_frames_read = RxFramesLen;
+
+            /* If read is successful, status is success */
+            Status = Result::Success;
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::readMerged(FrameType (&out_frames)[RxFramesLen],
+                                  std::size_t&       out_frames_read,
+                                  std::uint_fast8_t& out_interface_index)
+{
+    /* Initialize return value and output reference values */
+    Result Status       = Result::SuccessNothing;
+    out_frames_read     = 0;
+    out_interface_index = 0;
+
+    /* Take the next frame of every interface without a head frame, through read() so the expiry, polling mode and
+     * classic instances are handled the same. A head frame that exceeded the maximum frame age meanwhile is dropped
+     * first, so it doesn't take part in the merge */
+    const std::uint64_t now = time_Ticks() / 80u;
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        std::size_t frames_read = 0;
+        FrameType   head[RxFramesLen];
+
+        DISABLE_INTERRUPTS()
+        if (g_merge_pending[i] && frame_Expired(i, g_merge_head[i], now))
+        {
+            g_merge_pending[i] = false;
+            g_expired_frames_count[i]++;
+        }
+        ENABLE_INTERRUPTS()
+
+        if (!g_merge_pending[i] && isSuccess(read(i + 1u, head, frames_read)) && frames_read)
+        {
+            DISABLE_INTERRUPTS()
+            g_merge_head[i]    = head[0];
+            g_merge_pending[i] = true;
+            g_ready_mask |= readyRX(i + 1u);
+            ENABLE_INTERRUPTS()
+        }
+    }
+
+    /* Merge the heads by hardware timestamp, the earliest one is returned */
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        if (g_merge_pending[i] &&
+            (!out_interface_index || (g_merge_head[i].timestamp < g_merge_head[out_interface_index - 1].timestamp)))
+        {
+            out_interface_index = static_cast<std::uint_fast8_t>(i + 1u);
+        }
+    }
+
+    if (out_interface_index)
+    {
+        Status = read(out_interface_index, out_frames, out_frames_read);
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+InterfaceGroup::FrameRef::FrameRef()
+    : slot_(Empty)
+{}
+
+InterfaceGroup::FrameRef::FrameRef(std::uint8_t slot)
+    : slot_(slot)
+{}
+
+InterfaceGroup::FrameRef::FrameRef(const FrameRef& rhs)
+    : slot_(rhs.slot_)
+{
+    if (slot_ != Empty)
+    {
+        g_shared_frames[slot_].refs.fetch_add(1u);
+    }
+}
+
+InterfaceGroup::FrameRef& InterfaceGroup::FrameRef::operator=(const FrameRef& rhs)
+{
+    /* Reference the new frame before dropping the previous one, which may be the same */
+    if (rhs.slot_ != Empty)
+    {
+        g_shared_frames[rhs.slot_].refs.fetch_add(1u);
+    }
+    reset();
+    slot_ = rhs.slot_;
+
+    return *this;
+}
+
+InterfaceGroup::FrameRef::~FrameRef()
+{
+    reset();
+}
+
+void InterfaceGroup::FrameRef::reset()
+{
+    /* The slot is free for the ISR again once its count drops to 0 */
+    if (slot_ != Empty)
+    {
+        g_shared_frames[slot_].refs.fetch_sub(1u);
+        slot_ = Empty;
+    }
+}
+
+const InterfaceGroup::FrameType* InterfaceGroup::FrameRef::get() const
+{
+    return (slot_ != Empty) ? &g_shared_frames[slot_].frame : nullptr;
+}
+
+Result InterfaceGroup::registerPort(std::uint_fast8_t interface_index,
+                                    std::uint16_t     port_id,
+                                    bool              is_service,
+                                    PortCallback      callback)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) ||
+        (port_id > (is_service ? ID_Service_Mask : ID_Subject_Mask)))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t  instance = static_cast<std::uint8_t>(interface_index - 1);
+        std::uint16_t key      = port_Key(port_id, is_service);
+        DispatchPort* table    = g_dispatch_table[instance];
+
+        /* The table is modified atomically with respect to the ISR that searches it */
+        DISABLE_INTERRUPTS()
+
+        if (dispatch_Find(instance, key))
+        {
+            /* Already registered, nothing to do */
+        }
+        else if (g_dispatch_count[instance] >= Dispatch_Port_Count)
+        {
+            Status = Result::BufferFull;
+        }
+        else
+        {
+            /* Shift the entries with a greater key one place for keeping the table sorted, along with their queues */
+            std::uint8_t position = g_dispatch_count[instance];
+            while ((position > 0) && (table[position - 1].key > key))
+            {
+                table[position] = table[position - 1];
+                position--;
+            }
+
+            /* Fill up the new entry with an empty queue */
+            table[position].key              = key;
+            table[position].callback         = callback;
+            table[position].head             = 0;
+            table[position].tail             = 0;
+            table[position].discarded        = 0;
+            table[position].subscriber_count = 0;
+
+            g_dispatch_count[instance]++;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::subscribePort(std::uint_fast8_t interface_index,
+                                     std::uint16_t     port_id,
+                                     bool              is_service,
+                                     SharedCallback    callback,
+                                     void*             context)
+{
+    /* Input validation */
+    Result Status = callback ? registerPort(interface_index, port_id, is_service) : Result::BadArgument;
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The subscribers are invoked by the ISR */
+        DISABLE_INTERRUPTS()
+
+        DispatchPort* port       = dispatch_Find(instance, port_Key(port_id, is_service));
+        bool          subscribed = false;
+        for (std::uint8_t i = 0; i < port->subscriber_count; i++)
+        {
+            subscribed |= (port->subscribers[i].callback == callback) && (port->subscribers[i].context == context);
+        }
+
+        if (subscribed)
+        {
+            /* Already subscribed, nothing to do */
+        }
+        else if (port->subscriber_count >= MaxSubscribers)
+        {
+            Status = Result::BufferFull;
+        }
+        else
+        {
+            port->subscribers[port->subscriber_count].callback = callback;
+            port->subscribers[port->subscriber_count].context  = context;
+            port->subscriber_count++;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::readPort(std::uint_fast8_t interface_index,
+                                std::uint16_t     port_id,
+                                bool              is_service,
+                                FrameType (&out_frames)[RxFramesLen],
+                                std::size_t& out_frames_read)
+{
+    /* Initialize return value and out_frames_read output reference value */
+    Result Status   = Result::SuccessNothing;
+    out_frames_read = 0;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        DispatchPort* port =
+            dispatch_Find(static_cast<std::uint8_t>(interface_index - 1), port_Key(port_id, is_service));
+
+        if (!port)
+        {
+            Status = Result::NotFound;
+        }
+
+        /* Check if the port's queue isn't empty */
+        else if (port->head != port->tail)
+        {
+            /* Copy the oldest frame and release its slot back to the ISR */
+            out_frames[0] = port->frames[port->head];
+            port->head    = static_cast<std::uint8_t>((port->head + 1u) % Port_Frame_Capacity);
+
+            /* Perform byte swap */
+            payload_ByteSwap(out_frames[0]);
+
+            /* Default RX number of frames read at once by this implementation is 1 */
+            out_frames_read = RxFramesLen;
+
+            Status = Result::Success;
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setTransmitPreemption(std::uint_fast8_t interface_index, bool enable)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        g_tx_preemption[interface_index - 1] = enable;
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setTransmitLane(std::uint_fast8_t interface_index,
+                                       std::uint8_t      lane,
+                                       std::uint8_t      lowest_priority)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || (lane >= TX_MB_Count) ||
+        (lowest_priority > ID_Priority_Mask))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        /* Lanes are read by the ISR when refilling the MB's */
+        DISABLE_INTERRUPTS()
+        g_tx_lane_priority[interface_index - 1][lane] = lowest_priority;
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getTransmitStatistics(std::uint_fast8_t   interface_index,
+                                             TransmitStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        out_statistics.preempted = g_preempted_frames_count[interface_index - 1];
+        out_statistics.requeued  = g_requeued_frames_count[interface_index - 1];
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setPollingMode(std::uint_fast8_t interface_index, bool enable)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        g_rx_polling[interface_index - 1] = enable;
+
+        /* Mask or unmask the interrupts of the RX MB's if the instance is already clocked, IMASK1 can be written
+         * outside of freeze mode. The transmission MB's keep interrupting for refilling them from the queue */
+        if (!Classic_CAN[interface_index - 1] &&
+            (PCC->PCCn[PCC_FlexCAN_Index[interface_index - 1]] & PCC_PCCn_CGC_MASK))
+        {
+            FlexCAN[interface_index - 1]->IMASK1 = CAN_IMASK1_BUF31TO0M(
+                (TX_MB_Mask & ~g_tx_MB_pinned[interface_index - 1]) |
+                (enable ? 0u : (RX_MB_Mask & ~g_rx_storm_masked[interface_index - 1])));
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setAdmissionPolicy(std::uint_fast8_t   interface_index,
+                                          AdmissionPolicy     policy,
+                                          duration::Monotonic max_frame_age)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || (max_frame_age.toMicrosecond() < 0))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        g_admission_policy[interface_index - 1] = policy;
+        g_max_frame_age[interface_index - 1]    = static_cast<std::uint64_t>(max_frame_age.toMicrosecond());
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getAdmissionStatistics(std::uint_fast8_t    interface_index,
+                                              AdmissionStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        out_statistics.dropped_full     = g_discarded_frames_count[interface_index - 1];
+        out_statistics.evicted_priority = g_evicted_frames_count[interface_index - 1];
+        out_statistics.dropped_reserved = g_reserved_frames_count[interface_index - 1];
+        out_statistics.expired_age      = g_expired_frames_count[interface_index - 1];
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getReceiveStatistics(std::uint_fast8_t  interface_index,
+                                            ReceiveStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        out_statistics.overrun = g_overrun_frames_count[interface_index - 1];
+        out_statistics.torn    = g_torn_frames_count[interface_index - 1];
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setGatewayRules(std::uint_fast8_t  interface_index,
+                                       const ForwardRule* rules,
+                                       std::size_t        rules_length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || (rules_length > Gateway_Rule_Count) ||
+        (!rules && rules_length) || (Gateway_Peer[interface_index - 1] >= CANFD_Count) ||
+        (Gateway_Peer[interface_index - 1] == interface_index - 1))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        /* The rules are read by the ISR of the interface */
+        DISABLE_INTERRUPTS()
+        std::copy(rules, rules + rules_length, g_gateway_rules[interface_index - 1]);
+        g_gateway_rule_count[interface_index - 1] = static_cast<std::uint8_t>(rules_length);
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getGatewayStatistics(std::uint_fast8_t  interface_index,
+                                            GatewayStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        out_statistics.forwarded   = g_forwarded_frames_count[interface_index - 1];
+        out_statistics.queued      = g_forward_queued_count[interface_index - 1];
+        out_statistics.dropped     = g_forward_dropped_count[interface_index - 1];
+        out_statistics.latency_max = g_forward_latency_max[interface_index - 1];
+        for (std::uint8_t i = 0; i < GatewayLatencyBuckets; i++)
+        {
+            out_statistics.latency_histogram[i] = g_forward_latency_histogram[interface_index - 1][i];
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setRateLimits(std::uint_fast8_t interface_index,
+                                     const RateLimit*  limits,
+                                     std::size_t       limits_length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || (limits_length > MaxRateLimits) ||
+        (!limits && limits_length))
+    {
+        Status = Result::BadArgument;
+    }
+
+    /* Every limit must refill and hold at least a frame of the longest payload */
+    for (std::size_t i = 0; isSuccess(Status) && (i < limits_length); i++)
+    {
+        if (!limits[i].rate || (limits[i].burst < (FrameType::MTUBytes + Frame_Overhead_Bytes)))
+        {
+            Status = Result::BadArgument;
+        }
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t        instance = static_cast<std::uint8_t>(interface_index - 1);
+        const std::uint64_t now      = time_Ticks();
+
+        /* The limits are checked by write() and writeBalanced() with interrupts disabled, the buckets start full */
+        DISABLE_INTERRUPTS()
+        for (std::size_t i = 0; i < limits_length; i++)
+        {
+            g_rate_limits[instance][i]            = limits[i];
+            g_rate_buckets[instance][i].tokens    = static_cast<std::uint64_t>(limits[i].burst) * Ticks_Per_Second;
+            g_rate_buckets[instance][i].stamp     = now;
+            g_rate_buckets[instance][i].throttled = 0;
+        }
+        g_rate_limit_count[instance] = static_cast<std::uint8_t>(limits_length);
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getRateLimitStatistics(std::uint_fast8_t     interface_index,
+                                              std::size_t           limit_index,
+                                              RateLimitStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) ||
+        (limit_index >= g_rate_limit_count[interface_index - 1]))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        const TokenBucket& bucket = g_rate_buckets[interface_index - 1][limit_index];
+
+        out_statistics.throttled = bucket.throttled;
+        out_statistics.available = static_cast<std::uint32_t>(bucket.tokens / Ticks_Per_Second);
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setStormProtection(std::uint_fast8_t   interface_index,
+                                          std::uint32_t       max_frames,
+                                          duration::Monotonic window,
+                                          duration::Monotonic backoff)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) ||
+        (max_frames && ((window.toMicrosecond() <= 0) || (backoff.toMicrosecond() <= 0))))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t        instance = static_cast<std::uint8_t>(interface_index - 1);
+        const std::uint64_t now      = time_Ticks();
+
+        /* The monitors are updated by the ISR, they restart with the new threshold */
+        DISABLE_INTERRUPTS()
+        g_storm_max_frames[instance] = max_frames;
+        g_storm_window[instance]     = static_cast<std::uint64_t>(window.toMicrosecond()) * 80u;
+        g_storm_backoff[instance]    = static_cast<std::uint64_t>(backoff.toMicrosecond()) * 80u;
+        for (std::uint8_t j = 0; j < Filter_Count; j++)
+        {
+            g_storm[instance][j].window = now;
+            g_storm[instance][j].frames = 0;
+
+            /* Disabling the protection ends every back-off right away */
+            if (!max_frames && g_storm[instance][j].until)
+            {
+                g_storm[instance][j].until = now;
+            }
+        }
+        storm_Service(now);
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getStormStatistics(std::uint_fast8_t interface_index,
+                                          std::size_t       filter_index,
+                                          StormStatistics&  out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || (filter_index >= Filter_Count) ||
+        !g_rx_filter_MBs[interface_index - 1][filter_index])
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        const StormMonitor& monitor = g_storm[interface_index - 1][filter_index];
+
+        out_statistics.events = monitor.events;
+        out_statistics.frames = monitor.frames;
+        out_statistics.masked = (monitor.until != 0);
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::setFilterTuning(std::uint_fast8_t interface_index, const FilterTuning& tuning)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || Classic_CAN[interface_index - 1] ||
+        (tuning.epoch.toMicrosecond() < 0) || (tuning.reject_percent > 100u) || !tuning.stable_epochs)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        FilterTuner& tuner = g_tuner[interface_index - 1];
+
+        /* The hits are counted by the ISR while the epoch's length isn't 0 */
+        DISABLE_INTERRUPTS()
+        tuner.config      = tuning;
+        tuner.epoch       = static_cast<std::uint64_t>(tuning.epoch.toMicrosecond()) * 80u;
+        tuner.epoch_start = time_Ticks();
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::reportRejected(std::uint_fast8_t interface_index, const FrameType& frame)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || !g_tuner[interface_index - 1].epoch)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        FilterTuner&        tuner  = g_tuner[interface_index - 1];
+        const std::uint32_t id     = frame.id & FrameType::MaskExtID;
+        std::uint8_t        filter = 0;
+
+        /* FlexCAN matches the reception MB's in order, the first filter accepting the ID received the frame */
+        while ((filter < tuner.count) && ((id ^ tuner.current[filter].id) & tuner.current[filter].mask))
+        {
+            filter++;
+        }
+
+        if (filter < tuner.count)
+        {
+            DISABLE_INTERRUPTS()
+            TuningPort* port = tuning_Port(tuner.hits[filter], port_Key(id));
+            tuner.hits[filter].rejected++;
+            if (port)
+            {
+                port->rejected++;
+            }
+            ENABLE_INTERRUPTS()
+        }
+        else
+        {
+            Status = Result::NotFound;
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::tuneFilters(std::uint_fast8_t interface_index)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || !g_tuner[interface_index - 1].epoch)
+    {
+        Status = Result::BadArgument;
+    }
+
+    const std::uint64_t now = time_Ticks();
+
+    if (isSuccess(Status) && ((now - g_tuner[interface_index - 1].epoch_start) < g_tuner[interface_index - 1].epoch))
+    {
+        Status = Result::SuccessNothing;
+    }
+
+    if (Status == Result::Success)
+    {
+        const std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+        FilterTuner&       tuner    = g_tuner[instance];
+        FrameType::Filter  next[Filter_Count];
+        bool               change  = false;
+        bool               relearn = false;
+
+        /* Close the epoch of every filter */
+        DISABLE_INTERRUPTS()
+        tuner.epoch_start = now;
+        for (std::uint8_t j = 0; j < tuner.count; j++)
+        {
+            tuning_Propose(instance, j);
+            next[j].id   = tuner.current[j].id;
+            next[j].mask = tuner.current[j].mask;
+        }
+        ENABLE_INTERRUPTS()
+
+        /* Tightened filters go back to the application's ones once in a while, the only way they're widened */
+        if (tuner.tightened && tuner.config.relearn_epochs && (++tuner.tightened > tuner.config.relearn_epochs))
+        {
+            for (std::uint8_t j = 0; j < tuner.count; j++)
+            {
+                next[j].id   = tuner.base[j].id;
+                next[j].mask = tuner.base[j].mask;
+            }
+            relearn = true;
+        }
+
+        /* Apply the proposals that held for enough epochs */
+        for (std::uint8_t j = 0; !relearn && tuner.config.apply && (j < tuner.count); j++)
+        {
+            const FrameType::Filter& proposed = tuner.hits[j].proposed;
+
+            if ((tuner.hits[j].stable >= tuner.config.stable_epochs) &&
+                ((proposed.id != next[j].id) || (proposed.mask != next[j].mask)))
+            {
+                next[j].id   = proposed.id;
+                next[j].mask = proposed.mask;
+                change       = true;
+            }
+        }
+
+        if (relearn || change)
+        {
+            /* The depths are kept, so is the layout of the reception MB's */
+            Status = reconfigure_Instance(instance, next, tuner.depth, tuner.count);
+
+            if (isSuccess(Status) && relearn)
+            {
+                tuning_Rebase(instance);
+            }
+            else if (isSuccess(Status) && !tuner.tightened)
+            {
+                tuner.tightened = 1;
+            }
+        }
+        else
+        {
+            Status = Result::SuccessNothing;
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getFilterHitStatistics(std::uint_fast8_t    interface_index,
+                                              std::size_t          filter_index,
+                                              FilterHitStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index > CANFD_Count) || (!interface_index) || (filter_index >= g_tuner[interface_index - 1].count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        const FilterTuner& tuner = g_tuner[interface_index - 1];
+        const FilterHits&  hits  = tuner.hits[filter_index];
+
+        DISABLE_INTERRUPTS()
+        out_statistics.accepted      = hits.last_accepted;
+        out_statistics.rejected      = hits.last_rejected;
+        out_statistics.proposed.id   = hits.proposed.id;
+        out_statistics.proposed.mask = hits.proposed.mask;
+        out_statistics.stable        = hits.stable;
+        out_statistics.tightened     = (tuner.current[filter_index].id != tuner.base[filter_index].id) ||
+                                       (tuner.current[filter_index].mask != tuner.base[filter_index].mask);
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::addPublication(std::uint_fast8_t   interface_index,
+                                      const FrameType&    frame,
+                                      duration::Monotonic period,
+                                      bool                pinned,
+                                      std::uint8_t&       out_handle)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || (period.toMicrosecond() <= 0) ||
+        (Classic_CAN[interface_index - 1] && (frame.getDataLength() > Classic_Max_Length)))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The scheduler and the transmission ISR share the publications and the MB's */
+        DISABLE_INTERRUPTS()
+
+        std::uint8_t handle = MaxPublications;
+        for (std::uint8_t i = 0; (handle == MaxPublications) && (i < MaxPublications); i++)
+        {
+            handle = g_publications[i].period ? handle : i;
+        }
+
+        /* Pin the idle MB with the highest index, as long as another one is left for the transmission queue */
+        std::uint8_t MB_index = TX_MB_Count;
+        std::uint8_t unpinned = 0;
+        for (std::uint8_t i = 0; pinned && (i < TX_MB_Count); i++)
+        {
+            if (!(g_tx_MB_pinned[instance] & (1u << i)))
+            {
+                unpinned++;
+                MB_index = (g_tx_MB_busy[instance] & (1u << i)) ? MB_index : i;
+            }
+        }
+
+        if ((handle == MaxPublications) || (pinned && ((unpinned < 2u) || (MB_index == TX_MB_Count))))
+        {
+            Status = Result::BufferFull;
+        }
+        else
+        {
+            Publication& publication = g_publications[handle];
+            publication.frame        = frame;
+            publication.period       = static_cast<std::uint64_t>(period.toMicrosecond()) * 80u;
+            publication.due          = time_Ticks();
+            publication.dirty        = 0xFFFFFFFFu;
+            publication.published    = 0;
+            publication.skipped      = 0;
+            publication.instance     = instance;
+            publication.MB           = pinned ? MB_index : TX_MB_Count;
+
+            if (pinned)
+            {
+                /* Keep the MB away from the transmission queue and its interrupt, the scheduler rewrites it */
+                const std::uint32_t flag = 1u << (TX_MB_Base(instance) + MB_index);
+                g_tx_MB_pinned[instance] |= 1u << MB_index;
+                g_tx_MB_busy[instance] |= 1u << MB_index;
+                FlexCAN[instance]->IMASK1 &= ~flag;
+                FlexCAN[instance]->IFLAG1 = flag;
+
+                /* The ID word is written once, along with the frame's priority class as local priority */
+                FlexCAN[instance]->RAMn[TX_MB_Word(instance, MB_index) + 1] =
+                    (frame.id & CAN_WMBn_ID_ID_MASK) |
+                    (static_cast<std::uint32_t>(frame_Priority(frame.id)) << MB_Prio_Shift);
+            }
+
+            out_handle = handle;
+            scheduler_Arm(publication.due);
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::patchPublication(std::uint8_t        handle,
+                                        std::size_t         offset,
+                                        const std::uint8_t* data,
+                                        std::size_t         length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((handle >= MaxPublications) || !g_publications[handle].period || !data || !length ||
+        ((offset + length) > g_publications[handle].frame.getDataLength()))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        Publication& publication = g_publications[handle];
+
+        /* Patch the template and mark its words for the next load of the pinned MB */
+        DISABLE_INTERRUPTS()
+
+        std::copy(data, data + length, publication.frame.data + offset);
+        for (std::size_t word = offset >> 2; word <= ((offset + length - 1u) >> 2); word++)
+        {
+            publication.dirty |= 1u << word;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::removePublication(std::uint8_t handle)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((handle >= MaxPublications) || !g_publications[handle].period)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        Publication& publication = g_publications[handle];
+        std::uint8_t instance    = publication.instance;
+
+        DISABLE_INTERRUPTS()
+
+        publication.period = 0;
+
+        /* Deactivate a pinned MB and hand it back to the transmission queue */
+        if (publication.MB < TX_MB_Count)
+        {
+            const std::uint32_t flag = 1u << (TX_MB_Base(instance) + publication.MB);
+            volatile std::uint32_t& MB_CS = FlexCAN[instance]->RAMn[TX_MB_Word(instance, publication.MB)];
+
+            MB_CS = (MB_CS & ~MB_Code_Mask) | (static_cast<std::uint32_t>(TX_Inactive) << MB_Code_Shift);
+            FlexCAN[instance]->IFLAG1 = flag;
+            g_tx_MB_pinned[instance] &= ~(1u << publication.MB);
+            g_tx_MB_busy[instance] &= ~(1u << publication.MB);
+            FlexCAN[instance]->IMASK1 |= flag;
+
+            FlexCAN_interrupt::transmit_Pump(instance);
+        }
+
+        scheduler_Arm(time_Ticks());
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::getPublicationStatistics(std::uint8_t handle, PublicationStatistics& out_statistics) const
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((handle >= MaxPublications) || !g_publications[handle].period)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        out_statistics.published = g_publications[handle].published;
+        out_statistics.skipped   = g_publications[handle].skipped;
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::writeAt(std::uint_fast8_t interface_index,
+                               const FrameType&  frame,
+                               time::Monotonic   target,
+                               std::uint8_t&     out_handle)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) ||
+        (Classic_CAN[interface_index - 1] && (frame.getDataLength() > Classic_Max_Length)))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The calendar is shared with the scheduler and transmission ISR's */
+        DISABLE_INTERRUPTS()
+
+        std::uint8_t entry = CalendarLength;
+        for (std::uint8_t i = 0; (entry == CalendarLength) && (i < CalendarLength); i++)
+        {
+            entry = (g_calendar[instance][i].state == Timed_Free) ? i : entry;
+        }
+
+        if (entry == CalendarLength)
+        {
+            Status = Result::BufferFull;
+        }
+        else
+        {
+            TimedFrame& timed = g_calendar[instance][entry];
+            timed.frame       = frame;
+            timed.target      = target.toMicrosecond() * 80u;
+            timed.sof         = 0;
+            timed.state       = Timed_Scheduled;
+            out_handle        = entry;
+
+            /* A target already near is preloaded and, if reached, activated right away */
+            const std::uint64_t now = time_Ticks();
+            FlexCAN_interrupt::calendar_Service(now);
+            scheduler_Arm(now);
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::readTimedReport(std::uint_fast8_t interface_index,
+                                       std::uint8_t      handle,
+                                       TimedReport&      out_report)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || (handle >= CalendarLength) ||
+        (g_calendar[interface_index - 1][handle].state == Timed_Free))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        TimedFrame& timed = g_calendar[interface_index - 1][handle];
+
+        DISABLE_INTERRUPTS()
+
+        out_report.target = time::Monotonic::fromMicrosecond(timed.target / 80u);
+        out_report.sof    = time::Monotonic::fromMicrosecond(timed.sof);
+
+        if (timed.state == Timed_Sent)
+        {
+            timed.state = Timed_Free;
+        }
+        else if (timed.state == Timed_Missed)
+        {
+            timed.state = Timed_Free;
+            Status      = Result::Failure;
+        }
+        else
+        {
+            Status = Result::SuccessNothing;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::cancelWriteAt(std::uint_fast8_t interface_index, std::uint8_t handle)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || (handle >= CalendarLength) ||
+        (g_calendar[interface_index - 1][handle].state == Timed_Free))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+        TimedFrame&  timed    = g_calendar[instance][handle];
+
+        DISABLE_INTERRUPTS()
+
+        if (timed.state == Timed_Scheduled)
+        {
+            timed.state = Timed_Free;
+        }
+        else if (timed.state == Timed_Loaded)
+        {
+            /* The preloaded MB never got activated, hand it back to the transmission queue */
+            g_tx_MB_timed[instance] &= ~(1u << timed.MB);
+            g_tx_MB_busy[instance] &= ~(1u << timed.MB);
+            timed.state = Timed_Free;
+            FlexCAN_interrupt::transmit_Pump(instance);
+        }
+        else
+        {
+            /* Already in arbitration or finished, its report stays available */
+            Status = Result::Failure;
+        }
+
+        scheduler_Arm(time_Ticks());
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::reconfigureFilters(const typename FrameType::Filter* filter_config,
+                                          std::size_t                       filter_config_length)
+{
+    /* One message buffer per filter */
+    return reconfigureFilters(filter_config, nullptr, filter_config_length);
+}
+
+Result InterfaceGroup::reconfigureFilters(const typename FrameType::Filter* filter_config,
+                                          const std::uint8_t*               filter_depth,
+                                          std::size_t                       filter_config_length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if (!validate_Filters(filter_depth, filter_config_length))
+    {
+        Status = Result::BadArgument;
+    }
+
+    for (std::uint8_t i = 0; isSuccess(Status) && (i < CANFD_Count); i++)
+    {
+        Status = reconfigure_Instance(i, filter_config, filter_depth, filter_config_length);
+        tuning_Rebase(i);
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::reconfigureFilters(std::uint_fast8_t                 interface_index,
+                                          const typename FrameType::Filter* filter_config,
+                                          const std::uint8_t*               filter_depth,
+                                          std::size_t                       filter_config_length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) ||
+        !validate_Filters(filter_depth, filter_config_length))
+    {
+        Status = Result::BadArgument;
+    }
+
+    /* Only the selected instance halts, the others keep transmitting and receiving */
+    if (isSuccess(Status))
+    {
+        Status = reconfigure_Instance(static_cast<std::uint8_t>(interface_index - 1),
+                                      filter_config,
+                                      filter_depth,
+                                      filter_config_length);
+        tuning_Rebase(static_cast<std::uint8_t>(interface_index - 1));
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::loanFrame(std::uint_fast8_t interface_index, std::uint8_t*& out_payload)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The MB's are shared with the ISR that refills them */
+        DISABLE_INTERRUPTS()
+
+        if (g_tx_loaned[instance])
+        {
+            Status = Result::BufferFull;
+        }
+        else
+        {
+            /* Loan the idle MB with the most permissive lane, or else the staging frame */
+            std::uint8_t MB_index = TX_MB_Count;
+            for (std::uint8_t i = 0; i < TX_MB_Count; i++)
+            {
+                if (!(g_tx_MB_busy[instance] & (1u << i)) &&
+                    ((MB_index == TX_MB_Count) ||
+                     (g_tx_lane_priority[instance][i] > g_tx_lane_priority[instance][MB_index])))
+                {
+                    MB_index = i;
+                }
+            }
+
+            if (MB_index < TX_MB_Count)
+            {
+                g_tx_MB_busy[instance] |= 1u << MB_index;
+                g_tx_MB_loaned[instance] |= 1u << MB_index;
+                out_payload = g_tx_MB_frame[instance][MB_index].data;
+            }
+            else
+            {
+                out_payload = g_tx_loan_frame[instance].data;
+            }
+            g_tx_loaned[instance] = true;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::commitFrame(std::uint_fast8_t interface_index, std::uint32_t id, std::size_t length)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || !g_tx_loaned[interface_index - 1] ||
+        (length > FrameType::MTUBytes) || (Classic_CAN[interface_index - 1] && (length > Classic_Max_Length)))
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* The loaned MB, if any, is the only bit set in the mask */
+        std::uint8_t MB_index = 0;
+        while ((MB_index < TX_MB_Count) && !(g_tx_MB_loaned[instance] & (1u << MB_index)))
+        {
+            MB_index++;
         }
+        FrameType& frame = (MB_index < TX_MB_Count) ? g_tx_MB_frame[instance][MB_index] : g_tx_loan_frame[instance];
 
-        /* Enable interrupts back */
-        ENABLE_INTERRUPTS()
-    }
-};
-
-Result InterfaceGroup::messageBuffer_Transmit(std::uint_fast8_t iface_index,
-                                              std::uint8_t      TX_MB_index,
-                                              const FrameType&  frame)
-{
-    /* Get data length of the frame wanted to be transmitted */
-    std::uint_fast8_t payloadLength = frame.getDataLength();
+        /* Complete the frame, the padding up to a valid length is zeroed */
+        frame.id = id;
+        frame.setDataLength(static_cast<std::uint_fast8_t>(length));
+        std::fill(frame.data + length, frame.data + frame.getDataLength(), 0u);
 
-    /* Get the frame's dlc */
-    const std::uint32_t dlc = static_cast<std::underlying_type<libuavcan::media::CAN::FrameDLC>::type>(frame.getDLC());
+        DISABLE_INTERRUPTS()
 
-    /* Casting from uint8 to native uint32 for faster payload transfer to transmission message buffer */
-    std::uint32_t* native_FrameData = reinterpret_cast<std::uint32_t*>(const_cast<std::uint8_t*>(frame.data));
+        /* The rate limit is only charged once the frame is sure to be loaded or queued, as in write(), so a commit
+         * refused for a full queue and retried isn't charged twice */
+        const bool room = ((MB_index < TX_MB_Count) && FlexCAN_interrupt::loaned_Direct(instance, MB_index)) ||
+                          !transmitQueue_Full(instance);
 
-    /* Fill up the payload's bytes, including the ones that don't add up to a full word e.g. 1,2,3,5,6,7 byte data
-     * length payloads */
-    for (std::uint8_t i = 0; i < (payloadLength >> 2) + std::min(1, (static_cast<std::uint8_t>(payloadLength) & 0x3));
-         i++)
-    {
-        /* FlexCAN natively transmits the bytes in big-endian order, in order to transmit little-endian for UAVCAN,
-         * a byte swap is required */
-        REV_BYTES_32(native_FrameData[i], FlexCAN[iface_index]->RAMn[TX_MB_index * MB_Size_Words + MB_Data_Offset + i]);
-    }
-
-    /* Fill up frame ID */
-    FlexCAN[iface_index]->RAMn[TX_MB_index * MB_Size_Words + 1] = frame.id & CAN_WMBn_ID_ID_MASK;
-
-    /* Fill up word 0 of frame and transmit it
-     * Extended Data Length       (EDL) = 1
-     * Bit Rate Switch            (BRS) = 1
-     * Error State Indicator      (ESI) = 0
-     * Message Buffer Code       (CODE) = 12 ( Transmit data frame )
-     * Substitute Remote Request  (SRR) = 0
-     * ID Extended Bit            (IDE) = 1
-     * Remote Tx Request          (RTR) = 0
-     * Data Length Code           (DLC) = frame's dlc
-     * Counter Time Stamp  (TIME STAMP) = 0 ( Handled by hardware )
-     */
-    FlexCAN[iface_index]->RAMn[TX_MB_index * MB_Size_Words] =
-        CAN_RAMn_DATA_BYTE_1(0x20) | CAN_WMBn_CS_DLC(dlc) | CAN_RAMn_DATA_BYTE_0(0xCC);
+        if (!room || !rate_Admit(instance, frame))
+        {
+            Status = Result::BufferFull;
+        }
+        else if (MB_index < TX_MB_Count)
+        {
+            static_cast<void>(FlexCAN_interrupt::transmit_Loaned(instance, MB_index));
+        }
+        else
+        {
+            static_cast<void>(transmitQueue_Insert(instance, frame, false));
+            FlexCAN_interrupt::transmit_Pump(instance);
+        }
 
-    /* After a succesful transmission the interrupt flag of the corresponding message buffer is set, poll with
-     * timeout for it */
-    Result Status = flagPollTimeout_Set(FlexCAN[iface_index]->IFLAG1, 1 << TX_MB_index);
+        g_tx_loaned[instance] = (Status == Result::BufferFull);
 
-    /* Clear the flag previously polled (W1C register) */
-    FlexCAN[iface_index]->IFLAG1 |= 1u << TX_MB_index;
+        ENABLE_INTERRUPTS()
+    }
 
-    /* Return successful transmission request status */
+    /* Return status code */
     return Status;
 }
 
-std::uint_fast8_t InterfaceGroup::getInterfaceCount() const
-{
-    return CANFD_Count;
-}
-
-Result InterfaceGroup::write(std::uint_fast8_t interface_index,
-                             const FrameType (&frames)[TxFramesLen],
-                             std::size_t  frames_len,
-                             std::size_t& out_frames_written)
+Result InterfaceGroup::cancelLoan(std::uint_fast8_t interface_index)
 {
     /* Initialize return value status */
-    Result Status = Result::BufferFull;
+    Result Status = Result::Success;
 
     /* Input validation */
-    if ((frames_len > TxFramesLen) || (interface_index > CANFD_Count))
+    if ((interface_index == 0) || (interface_index > CANFD_Count) || !g_tx_loaned[interface_index - 1])
     {
         Status = Result::BadArgument;
     }
 
-    /* Poll the Inactive Message Buffer and Valid Priority Status flags before checking for free MB's */
-    if ((FlexCAN[interface_index - 1]->ESR2 & CAN_ESR2_IMB_MASK) &&
-        (FlexCAN[interface_index - 1]->ESR2 & CAN_ESR2_VPS_MASK))
+    if (isSuccess(Status))
+    {
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+
+        /* Release the loaned MB to the transmission queue */
+        DISABLE_INTERRUPTS()
+        g_tx_MB_busy[instance] &= ~g_tx_MB_loaned[instance];
+        g_tx_MB_loaned[instance] = 0;
+        g_tx_loaned[instance]    = false;
+        FlexCAN_interrupt::transmit_Pump(instance);
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result InterfaceGroup::writeGather(std::uint_fast8_t interface_index,
+                                   std::uint32_t     id,
+                                   const Segment*    segments,
+                                   std::size_t       segments_length)
+{
+    /* Input validation, the total length is checked by commitFrame() */
+    std::size_t length = 0;
+    for (std::size_t i = 0; segments && (i < segments_length); i++)
+    {
+        length += segments[i].length;
+    }
+
+    std::uint8_t* payload = nullptr;
+    Result        Status  = ((!segments && segments_length) || (length > FrameType::MTUBytes))
+                                ? Result::BadArgument
+                                : loanFrame(interface_index, payload);
+
+    if (isSuccess(Status))
     {
-        /* Look for the lowest number free MB */
-        std::uint8_t mb_index = (FlexCAN[interface_index - 1]->ESR2 & CAN_ESR2_LPTM_MASK) >> CAN_ESR2_LPTM_SHIFT;
+        /* Gather the segments straight into the loaned buffer */
+        std::uint8_t* cursor = payload;
+        for (std::size_t i = 0; i < segments_length; i++)
+        {
+            cursor = std::copy(segments[i].data, segments[i].data + segments[i].length, cursor);
+        }
 
-        /* Proceed with the tranmission */
-        Status = messageBuffer_Transmit(interface_index - 1, mb_index, frames[0]);
+        Status = commitFrame(interface_index, id, length);
 
-        /* Argument assignment to 1 Frame transmitted successfully */
-        out_frames_written = isSuccess(Status) ? TxFramesLen : 0;
+        /* A refused frame isn't retried, its loan ends */
+        if (isFailure(Status))
+        {
+            static_cast<void>(cancelLoan(interface_index));
+        }
     }
 
     /* Return status code */
     return Status;
 }
 
-Result InterfaceGroup::read(std::uint_fast8_t interface_index,
-                            FrameType (&out_frames)[RxFramesLen],
-                            std::size_t& out_frames_read)
+Result InterfaceGroup::submit(std::uint_fast8_t interface_index, const FrameType& frame)
 {
-    /* Initialize return value and out_frames_read output reference value */
-    Result Status   = Result::SuccessNothing;
-    out_frames_read = 0;
+    /* Initialize return value status */
+    Result Status = Result::Success;
 
     /* Input validation */
-    if (interface_index > CANFD_Count)
+    if ((interface_index == 0) || (interface_index > CANFD_Count) ||
+        (Classic_CAN[interface_index - 1] && (frame.getDataLength() > Classic_Max_Length)))
     {
         Status = Result::BadArgument;
     }
 
     if (isSuccess(Status))
     {
-        /* Check if the ISR buffer isn't empty */
-        if (!g_frame_ISRbuffer[interface_index - 1].empty())
+        std::uint8_t instance = static_cast<std::uint8_t>(interface_index - 1);
+        SubmitRing&  ring     = g_submit_ring[instance];
+
+        /* Claim the next free slot without locking, a producer preempted by another one retries at the position
+         * left by it */
+        std::uint32_t position = ring.enqueue.load(std::memory_order_relaxed);
+        SubmitSlot*   slot     = nullptr;
+        while (!slot && isSuccess(Status))
         {
-            /* Get the front element of the queue buffer */
-            out_frames[0] = g_frame_ISRbuffer[interface_index - 1].front();
-
-            /* Pop the front element of the queue buffer */
-            g_frame_ISRbuffer[interface_index - 1].pop_front();
-
-            /* Get the address of the payload for performing a byte swap in faster native 32-bit words */
-            std::uint32_t* data_address = reinterpret_cast<std::uint32_t*>(out_frames[0].data);
+            SubmitSlot&        candidate = ring.slots[position & (Submit_Ring_Capacity - 1u)];
+            const std::int32_t lap       = static_cast<std::int32_t>(
+                candidate.sequence.load(std::memory_order_acquire) - position);
 
-            /* Ceil for the number of words in the payload,  */
-            std::uint8_t payload_length_words =
-                (out_frames[0].getDataLength() >> 2) +
-                std::min(1, (static_cast<std::uint8_t>(out_frames[0].getDataLength()) & 0x3));
-
-            /* Perform byte swap */
-            for (std::uint8_t i = 0; i < payload_length_words; i++)
+            if (lap < 0)
             {
-                REV_BYTES_32(data_address[i], data_address[i]);
+                /* The slot still holds the frame of the previous lap, not drained yet */
+                Status = Result::BufferFull;
             }
+            else if (lap > 0)
+            {
+                position = ring.enqueue.load(std::memory_order_relaxed);
+            }
+            else if (ring.enqueue.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+            {
+                slot = &candidate;
+            }
+        }
 
-            /* Default RX number of frames read at once by this implementation is 1 */
-            out_frames_read = RxFramesLen;
-
-            /* If read is successful, status is success */
-            Status = Result::Success;
+        if (isSuccess(Status))
+        {
+            /* Publish the frame and pend the interface's ISR, which drains it */
+            slot->frame = frame;
+            slot->sequence.store(position + 1u, std::memory_order_release);
+            S32_NVIC->ISPR[FlexCAN_NVIC_Indices[instance][0]] = FlexCAN_NVIC_Indices[instance][1];
         }
     }
 
@@ -457,78 +4670,124 @@ Result InterfaceGroup::read(std::uint_fast8_t interface_index,
     return Status;
 }
 
-Result InterfaceGroup::reconfigureFilters(const typename FrameType::Filter* filter_config,
-                                          std::size_t                       filter_config_length)
+Result InterfaceGroup::setBalancePolicy(BalancePolicy policy)
+{
+    g_balance_policy = policy;
+
+    /* Return status code */
+    return Result::Success;
+}
+
+Result InterfaceGroup::writeBalanced(const FrameType (&frames)[TxFramesLen],
+                                     std::size_t  frames_len,
+                                     std::size_t& out_frames_written)
 {
     /* Initialize return value status */
-    Result Status = Result::Success;
+    Result Status      = Result::Success;
+    out_frames_written = 0;
 
     /* Input validation */
-    if (filter_config_length > Filter_Count)
+    if (frames_len > TxFramesLen)
     {
         Status = Result::BadArgument;
     }
 
-    if (isSuccess(Status))
+    /* Refresh the bus load estimations whose window elapsed */
+    if (isSuccess(Status) && (g_balance_policy == BalancePolicy::LowestBusLoad))
     {
+        std::uint64_t now = time_Ticks() / 80u;
+
         for (std::uint8_t i = 0; i < CANFD_Count; i++)
         {
-            /* Enter freeze mode for filter reconfiguration */
-            FlexCAN[i]->MCR |= (CAN_MCR_HALT_MASK | CAN_MCR_FRZ_MASK);
-
-            /* Block for freeze mode entry, halts any transmission or reception */
-            if (isSuccess(Status))
+            std::uint64_t elapsed = now - g_bus_load_stamp[i];
+            if (elapsed >= Bus_Load_Window)
             {
-                /* Reset all previous filter configurations */
-                for (std::uint8_t j = 0; j < CAN_RAMn_COUNT; j++)
-                {
-                    FlexCAN[i]->RAMn[j] = 0;
-                }
+                std::uint32_t bytes = g_bus_bytes[i].exchange(0, std::memory_order_relaxed);
 
-                /* Clear the reception masks before configuring the new ones needed */
-                for (std::uint8_t j = 0; j < CAN_RXIMR_COUNT; j++)
-                {
-                    FlexCAN[i]->RXIMR[j] = 0;
-                }
+                g_bus_load[i] = static_cast<std::uint32_t>((g_bus_load[i] + bytes * Bus_Load_Window / elapsed) / 2u);
+                g_bus_load_stamp[i] = now;
+            }
+        }
+    }
 
-                for (std::uint8_t j = 0; j < filter_config_length; j++)
-                {
-                    /* Setup reception MB's mask from input argument */
-                    FlexCAN[i]->RXIMR[j + 2] = filter_config[j].mask;
-
-                    /* Setup word 0 (4 Bytes) for ith MB
-                     * Extended Data Length      (EDL) = 1
-                     * Bit Rate Switch           (BRS) = 1
-                     * Error State Indicator     (ESI) = 0
-                     * Message Buffer Code      (CODE) = 4 ( Active for reception and empty )
-                     * Substitute Remote Request (SRR) = 0
-                     * ID Extended Bit           (IDE) = 1
-                     * Remote Tx Request         (RTR) = 0
-                     * Data Length Code          (DLC) = 0 ( Valid for transmission only )
-                     * Counter Time Stamp (TIME STAMP) = 0 ( Handled by hardware )
-                     */
-                    FlexCAN[i]->RAMn[(j + 2) * MB_Size_Words] = CAN_RAMn_DATA_BYTE_0(0xC4) | CAN_RAMn_DATA_BYTE_1(0x20);
-
-                    /* Setup Message buffers 2-7 29-bit extended ID from parameter */
-                    FlexCAN[i]->RAMn[(j + 2) * MB_Size_Words + 1] = filter_config[j].id;
-                }
+    while (isSuccess(Status) && (out_frames_written < frames_len))
+    {
+        const FrameType& frame    = frames[out_frames_written];
+        std::uint16_t    key      = port_Key(frame.id & FrameType::MaskExtID);
+        std::uint8_t     instance = CANFD_Count;
+        std::uint32_t    best     = 0;
 
-                /* Freeze mode exit request */
-                FlexCAN[i]->MCR &= ~(CAN_MCR_HALT_MASK | CAN_MCR_FRZ_MASK);
+        /* The queues are shared with the ISR's that drain them */
+        DISABLE_INTERRUPTS()
 
-                /* Block for freeze mode exit */
-                if (isSuccess(Status))
-                {
-                    Status = flagPollTimeout_Clear(FlexCAN[i]->MCR, CAN_MCR_FRZACK_MASK);
+        for (std::uint8_t i = 0; i < CANFD_Count; i++)
+        {
+            /* Bus off instances fail over to the healthy ones, classic ones only take frames of up to 8 bytes */
+            if (bus_Off(i) || (Classic_CAN[i] && (frame.getDataLength() > Classic_Max_Length)))
+            {
+                continue;
+            }
 
-                    /* Block until module is ready */
-                    if (isSuccess(Status))
-                    {
-                        Status = flagPollTimeout_Clear(FlexCAN[i]->MCR, CAN_MCR_NOTRDY_MASK);
-                    }
-                }
+            /* Frames of a subject or service stay on the instance that still holds one pending, so they keep their
+             * order */
+            if (tx_Holds_Key(i, key))
+            {
+                instance = i;
+                break;
+            }
+
+            /* Score of the instance under the policy, the lowest is chosen */
+            std::uint32_t busy = 0;
+            for (std::uint8_t j = 0; j < TX_MB_Count; j++)
+            {
+                busy += (g_tx_MB_busy[i] >> j) & 0x1u;
+            }
+
+            std::uint32_t score = 0;
+            switch (g_balance_policy)
+            {
+            case BalancePolicy::MostFreeMailboxes:
+                score = (busy << 8) | g_tx_queue[i].count;
+                break;
+            case BalancePolicy::ShortestQueue:
+                score = g_tx_queue[i].count + busy;
+                break;
+            case BalancePolicy::LowestBusLoad:
+                score = g_bus_load[i];
+                break;
             }
+
+            if ((instance == CANFD_Count) || (score < best))
+            {
+                instance = i;
+                best     = score;
+            }
+        }
+
+        if (instance == CANFD_Count)
+        {
+            /* Every instance is bus off or can't take the frame */
+            Status = Result::Failure;
+        }
+        else if (!transmitQueue_Full(instance) && rate_Admit(instance, frame) &&
+                 transmitQueue_Insert(instance, frame, false))
+        {
+            /* Load the highest priority frames into the free transmission MB's */
+            FlexCAN_interrupt::transmit_Pump(instance);
+            out_frames_written++;
         }
+        else
+        {
+            Status = Result::BufferFull;
+        }
+
+        ENABLE_INTERRUPTS()
+    }
+
+    /* Report the frames written before a failure */
+    if (!isSuccess(Status) && out_frames_written)
+    {
+        Status = Result::SuccessPartial;
     }
 
     /* Return status code */
@@ -537,51 +4796,50 @@ Result InterfaceGroup::reconfigureFilters(const typename FrameType::Filter* filt
 
 Result InterfaceGroup::select(duration::Monotonic timeout, bool ignore_write_available)
 {
-    /* Obtain timeout from object */
-    std::uint32_t cycles_timeout = static_cast<std::uint32_t>(timeout.toMicrosecond());
+    /* Wait for any interface to have frames to read, or room for writing unless ignore_write_available is set */
+    std::uint32_t mask = 0;
+    for (std::uint8_t i = 1; i <= CANFD_Count; i++)
+    {
+        mask |= readyRX(i) | (ignore_write_available ? 0u : readyTX(i));
+    }
 
-    /* Initialization of delta variable for comparison */
-    volatile std::uint32_t delta = 0;
+    std::uint32_t ready = 0;
+    return select(timeout, mask, ready);
+}
+
+Result InterfaceGroup::select(duration::Monotonic timeout, std::uint32_t mask, std::uint32_t& out_ready)
+{
+    /* Obtain timeout from object in ticks of the 80Mhz time base, LPIT channel 3 belongs to the scheduler of the
+     * periodic publications */
+    const std::uint64_t ticks_timeout = static_cast<std::uint64_t>(timeout.toMicrosecond()) * 80u;
+    const std::uint64_t start         = time_Ticks();
 
     /* Initialize status return value as timeout by default */
     Result Status = Result::SuccessTimeout;
+    out_ready     = 0;
 
-    /* Disable LPIT channel 3 for loading */
-    LPIT0->CLRTEN |= LPIT_CLRTEN_CLR_T_EN_3(1);
-
-    /* Load LPIT with its maximum value */
-    LPIT0->TMR[3].TVAL = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK;
-
-    /* Enable LPIT channel 3 for timeout start */
-    LPIT0->SETTEN |= LPIT_SETTEN_SET_T_EN_3(1);
-
-    /* Start of timed block */
-    while (delta < cycles_timeout)
+    /* Start of timed block, until an interface is ready */
+    while ((Status == Result::SuccessTimeout) && ((time_Ticks() - start) < ticks_timeout))
     {
-        /* Poll in each of the available interfaces */
+        std::uint32_t ready = g_ready_mask;
+
+        /* The frames of the RX MB's in polling mode and of the eDMA ring of a classic instance don't go through the
+         * ISR, check them in place */
         for (std::uint8_t i = 0; i < CANFD_Count; i++)
         {
-            /* Poll for available frames in RX FIFO */
-            if (!g_frame_ISRbuffer[i].empty())
-            {
-                Status = Result::Success;
-                break;
-            }
-
-            /* Check for available message buffers for transmission if ignore_write_available is false */
-            else if (!ignore_write_available)
+            if ((mask & readyRX(i + 1u)) &&
+                ((!Classic_CAN[i] && g_rx_polling[i] && (FlexCAN[i]->IFLAG1 & RX_MB_Mask)) ||
+                 (Classic_CAN[i] && (g_classic_head[i] != g_classic_tail[i]))))
             {
-                /* Poll the Inactive Message Buffer and Valid Priority Status flags for TX availability */
-                if ((FlexCAN[i]->ESR2 & CAN_ESR2_IMB_MASK) && (FlexCAN[i]->ESR2 & CAN_ESR2_VPS_MASK))
-                {
-                    Status = Result::Success;
-                    break;
-                }
+                ready |= readyRX(i + 1u);
             }
         }
 
-        /* Get current value of delta */
-        delta = LPIT_TMR_CVAL_TMR_CUR_VAL_MASK - (LPIT0->TMR[3].CVAL);
+        if (ready & mask)
+        {
+            out_ready = ready & mask;
+            Status    = Result::Success;
+        }
     }
 
     /* Return status code, if timeout occurred, the status will remain SuccessTimeout as initialized */
@@ -591,17 +4849,55 @@ Result InterfaceGroup::select(duration::Monotonic timeout, bool ignore_write_ava
 Result InterfaceManager::startInterfaceGroup(const typename InterfaceGroupType::FrameType::Filter* filter_config,
                                              std::size_t                                           filter_config_length,
                                              InterfaceGroupPtrType&                                out_group)
+{
+    /* The same filters, one MB each, and the default bit rates for every instance */
+    InterfaceConfig configs[CANFD_Count];
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        configs[i] = {filter_config, nullptr, filter_config_length, DefaultNominalBitrate, DefaultDataBitrate};
+    }
+
+    return startInterfaceGroup(configs, CANFD_Count, out_group);
+}
+
+Result InterfaceManager::startInterfaceGroup(const InterfaceConfig* configs,
+                                             std::size_t            configs_length,
+                                             InterfaceGroupPtrType& out_group)
 {
     /* Initialize return values */
     Result Status = Result::Success;
     out_group     = nullptr;
 
+    /* Prescaler division factors of the nominal and data phases of each instance */
+    std::uint32_t nominal_prescaler[CANFD_Count] = {};
+    std::uint32_t data_prescaler[CANFD_Count]    = {};
+
     /* Input validation */
-    if (filter_config_length > Filter_Count)
+    if (!configs || (configs_length != CANFD_Count))
     {
         Status = Result::BadArgument;
     }
 
+    for (std::uint8_t i = 0; isSuccess(Status) && (i < CANFD_Count); i++)
+    {
+        nominal_prescaler[i] = bitrate_Prescaler(configs[i].nominal_bitrate, Nominal_Bit_Quantas);
+        data_prescaler[i] =
+            Classic_CAN[i] ? 1u : bitrate_Prescaler(configs[i].data_bitrate, Data_Bit_Quantas);
+
+        /* The data phase of a CAN-FD instance can't be slower than its arbitration */
+        if (!validate_Filters(configs[i].filter_depth, configs[i].filter_config_length) || !nominal_prescaler[i] ||
+            !data_prescaler[i] || (!Classic_CAN[i] && (configs[i].data_bitrate < configs[i].nominal_bitrate)))
+        {
+            Status = Result::BadArgument;
+        }
+    }
+
+    /* Nothing gets started with an invalid configuration */
+    if (isFailure(Status))
+    {
+        return Status;
+    }
+
     /* SysClock initialization for feeding 80Mhz to FlexCAN */
 
     /* System Oscillator (SOSC) initialization for 8Mhz external crystal */
@@ -649,6 +4945,15 @@ Result InterfaceManager::startInterfaceGroup(const typename InterfaceGroupType::
     LPIT0->TMR[1].TCTRL |= LPIT_TMR_TCTRL_MODE(0);
     LPIT0->TMR[2].TCTRL |= LPIT_TMR_TCTRL_MODE(0);
 
+    /* Scheduler of the periodic publications on channel 3, 32-bit periodic timer reloaded for each due time */
+    LPIT0->TMR[3].TCTRL |= LPIT_TMR_TCTRL_MODE(0);
+    LPIT0->MIER |= LPIT_MIER_TIE3_MASK;
+    S32_NVIC->ISER[LPIT0_Ch3_IRQn >> 5] = 1u << (LPIT0_Ch3_IRQn & 0x1Fu);
+    for (std::uint8_t i = 0; i < InterfaceGroup::MaxPublications; i++)
+    {
+        g_publications[i].period = 0;
+    }
+
     /* Select chain mode for channel 1, this becomes the most significant 32 bits */
     LPIT0->TMR[1].TCTRL |= LPIT_TMR_TCTRL_CHAIN(1);
 
@@ -664,6 +4969,26 @@ Result InterfaceManager::startInterfaceGroup(const typename InterfaceGroupType::
     {
     };
 
+    /* Lowest priority for the PendSV bottom half of the deferred instances, so every other interrupt preempts it */
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        if (Deferred_RX[i])
+        {
+            S32_SCB->SHPR3 = (S32_SCB->SHPR3 & ~S32_SCB_SHPR3_PRI_14_MASK) | S32_SCB_SHPR3_PRI_14(PendSV_Priority);
+        }
+    }
+
+#if UAVCAN_DMA_PAYLOAD
+    /* eDMA with minor loop offsets for the byte swapped copies, and the completion interrupts of its channels */
+    DMA->CR |= DMA_CR_EMLM_MASK;
+    for (std::uint8_t i = 0; i < CANFD_Count; i++)
+    {
+        g_dma_TX_MB[i] = TX_MB_Count;
+
+        S32_NVIC->ISER[0] = 1u << DMA_TX_Channel[i];
+    }
+#endif
+
     /* FlexCAN instances initialization */
     for (std::uint8_t i = 0; i < CANFD_Count; i++)
     {
@@ -680,34 +5005,36 @@ Result InterfaceManager::startInterfaceGroup(const typename InterfaceGroupType::
         };
 
         /* Next configurations are only permitted in freeze mode */
-        FlexCAN[i]->MCR |= CAN_MCR_FDEN_MASK |          /* Habilitate CANFD feature */
-                           CAN_MCR_FRZ_MASK;            /* Enable freeze mode entry when HALT bit is asserted */
+        FlexCAN[i]->MCR |= (Classic_CAN[i] ? 0u : CAN_MCR_FDEN_MASK) | /* Habilitate CANFD feature */
+                           CAN_MCR_FRZ_MASK; /* Enable freeze mode entry when HALT bit is asserted */
         FlexCAN[i]->CTRL2 |= CAN_CTRL2_ISOCANFDEN_MASK; /* Activate the use of ISO 11898-1 CAN-FD standard */
 
-        /* CAN Bit Timing (CBT) configuration for a nominal phase of 1 Mbit/s with 80 time quantas,
-           in accordance with Bosch 2012 specification, sample point at 83.75% */
-        FlexCAN[i]->CBT |= CAN_CBT_BTF_MASK |     /* Enable extended bit timing configurations for CAN-FD
-                                                                                                                 for setting
-                                                           up separetely nominal and data phase */
-                           CAN_CBT_EPRESDIV(0) |  /* Prescaler divisor factor of 1 */
-                           CAN_CBT_EPROPSEG(46) | /* Propagation segment of 47 time quantas */
-                           CAN_CBT_EPSEG1(18) |   /* Phase buffer segment 1 of 19 time quantas */
-                           CAN_CBT_EPSEG2(12) |   /* Phase buffer segment 2 of 13 time quantas */
-                           CAN_CBT_ERJW(12);      /* Resynchronization jump width same as PSEG2 */
-
-        /* CAN-FD Bit Timing (FDCBT) for a data phase of 4 Mbit/s with 20 time quantas,
+        /* CAN Bit Timing (CBT) configuration for the nominal phase with 80 time quantas, the prescaler sets the
+           bit rate (1 Mbit/s with a factor of 1), in accordance with Bosch 2012 specification, sample point at
+           83.75%. Assigned rather than OR'ed so that a restart with other bit rates doesn't mix prescalers */
+        FlexCAN[i]->CBT = CAN_CBT_BTF_MASK | /* Enable extended bit timing configurations for CAN-FD for setting up
+                                                separetely nominal and data phase */
+                          CAN_CBT_EPRESDIV(nominal_prescaler[i] - 1u) | /* Prescaler divisor factor */
+                          CAN_CBT_EPROPSEG(46) |                        /* Propagation segment of 47 time quantas */
+                          CAN_CBT_EPSEG1(18) | /* Phase buffer segment 1 of 19 time quantas */
+                          CAN_CBT_EPSEG2(12) | /* Phase buffer segment 2 of 13 time quantas */
+                          CAN_CBT_ERJW(12);    /* Resynchronization jump width same as PSEG2 */
+
+        /* CAN-FD Bit Timing (FDCBT) for the data phase with 20 time quantas (4 Mbit/s with a factor of 1),
            in accordance with Bosch 2012 specification, sample point at 75% */
-        FlexCAN[i]->FDCBT |=
-            CAN_FDCBT_FPRESDIV(0) | /* Prescaler divisor factor of 1 */
-            CAN_FDCBT_FPROPSEG(7) | /* Propagation semgment of 7 time quantas
-                                                                   (only register that doesn't add 1) */
-            CAN_FDCBT_FPSEG1(6) |   /* Phase buffer segment 1 of 7 time quantas */
-            CAN_FDCBT_FPSEG2(4) |   /* Phase buffer segment 2 of 5 time quantas */
-            CAN_FDCBT_FRJW(4);      /* Resynchorinzation jump width same as PSEG2 */
+        FlexCAN[i]->FDCBT =
+            CAN_FDCBT_FPRESDIV(data_prescaler[i] - 1u) | /* Prescaler divisor factor */
+            CAN_FDCBT_FPROPSEG(7) |                      /* Propagation semgment of 7 time quantas
+                                                            (only register that doesn't add 1) */
+            CAN_FDCBT_FPSEG1(6) | /* Phase buffer segment 1 of 7 time quantas */
+            CAN_FDCBT_FPSEG2(4) | /* Phase buffer segment 2 of 5 time quantas */
+            CAN_FDCBT_FRJW(4);    /* Resynchorinzation jump width same as PSEG2 */
 
         /* Additional CAN-FD configurations */
+        FlexCAN[i]->FDCTRL &= ~CAN_FDCTRL_TDCEN_MASK;  /* Clear the compensation of a previous start */
         FlexCAN[i]->FDCTRL |= CAN_FDCTRL_FDRATE_MASK | /* Enable bit rate switch in data phase of frame */
-                              CAN_FDCTRL_TDCEN_MASK |  /* Enable transceiver delay compensation */
+                              /* Enable transceiver delay compensation, only valid for the fastest data phases */
+                              ((data_prescaler[i] <= Max_TDC_Prescaler_Factor) ? CAN_FDCTRL_TDCEN_MASK : 0u) |
                               CAN_FDCTRL_TDCOFF(5) |   /* Setup 5 cycles for data phase sampling delay */
                               CAN_FDCTRL_MBDSR0(3);    /* Setup 64 bytes per message buffer (7 MB's) */
 
@@ -729,36 +5056,69 @@ Result InterfaceManager::startInterfaceGroup(const typename InterfaceGroupType::
         /* Setup maximum number of message buffers as 7, 0th and 1st for transmission and 2nd-6th for RX */
         FlexCAN[i]->MCR &= ~CAN_MCR_MAXMB_MASK; /* Clear previous configuracion of MAXMB, default is 0xF */
         FlexCAN[i]->MCR |= CAN_MCR_MAXMB(6) | CAN_MCR_SRXDIS_MASK | /* Disable self-reception of frames if ID matches */
-                           CAN_MCR_IRMQ_MASK;                       /* Enable individual message buffer masking */
-
-        /* Setup Message buffers 2nd-6th for reception and set filters */
-        for (std::uint8_t j = 0; j < filter_config_length; j++)
+                           CAN_MCR_IRMQ_MASK |                      /* Enable individual message buffer masking */
+                           CAN_MCR_AEN_MASK |                       /* Enable the abort of pending transmissions */
+                           CAN_MCR_LPRIOEN_MASK;                    /* Enable the local priority of TX MB's */
+        FlexCAN[i]->CTRL1 &= ~CAN_CTRL1_LBUF_MASK; /* Transmit the highest priority MB first, not the lowest numbered */
+
+        /* Classic instances use the RX FIFO with an 8 element ID filter table, drained by eDMA, and the 8th-9th MB's
+         * for transmission */
+        if (Classic_CAN[i])
         {
-            /* Setup reception MB's mask from input argument */
-            FlexCAN[i]->RXIMR[j + 2] = filter_config[j].mask;
-
-            /* Setup word 0 (4 Bytes) for ith MB
-             * Extended Data Length      (EDL) = 1
-             * Bit Rate Switch           (BRS) = 1
-             * Error State Indicator     (ESI) = 0
-             * Message Buffer Code      (CODE) = 4 ( Active for reception and empty )
-             * Substitute Remote Request (SRR) = 0
-             * ID Extended Bit           (IDE) = 1
-             * Remote Tx Request         (RTR) = 0
-             * Data Length Code          (DLC) = 0 ( Valid for transmission only )
-             * Counter Time Stamp (TIME STAMP) = 0 ( Handled by hardware )
-             */
-            FlexCAN[i]->RAMn[(j + 2) * MB_Size_Words] = CAN_RAMn_DATA_BYTE_0(0xC4) | CAN_RAMn_DATA_BYTE_1(0x20);
-
-            /* Setup Message buffers 2-7 29-bit extended ID from parameter */
-            FlexCAN[i]->RAMn[(j + 2) * MB_Size_Words + 1] = filter_config[j].id;
+            FlexCAN[i]->MCR &= ~CAN_MCR_MAXMB_MASK;
+            FlexCAN[i]->MCR |= CAN_MCR_MAXMB(Classic_TX_MB_Base + TX_MB_Count - 1u) | CAN_MCR_RFEN_MASK |
+                               CAN_MCR_DMA_MASK;
+            FlexCAN[i]->CTRL2 &= ~CAN_CTRL2_RFFN_MASK;
         }
 
+        /* Setup Message buffers 2nd-6th for reception and set the filters of this instance */
+        configure_Filters(i, configs[i].filter_config, configs[i].filter_depth, configs[i].filter_config_length);
+        tuning_Rebase(i);
+
         /* Enable interrupt in NVIC for FlexCAN reception with default priority (ID = 81) */
         S32_NVIC->ISER[FlexCAN_NVIC_Indices[i][0]] = FlexCAN_NVIC_Indices[i][1];
 
-        /* Enable interrupts of reception MB's (0b1111100) */
-        FlexCAN[i]->IMASK1 = CAN_IMASK1_BUF31TO0M(124);
+        /* Enable interrupts of transmission (0b0000011) and, unless in polling mode, reception MB's (0b1111100).
+         * Classic instances interrupt for their transmission MB's and for the overflows of the RX FIFO */
+        if (Classic_CAN[i])
+        {
+            FlexCAN[i]->IMASK1 = CAN_IMASK1_BUF31TO0M((TX_MB_Mask << Classic_TX_MB_Base) | Classic_FIFO_Overflow_Mask);
+            g_classic_head[i]  = 0;
+            g_classic_tail[i]  = 0;
+            classic_StartDMA(i);
+
+            /* Enable the interrupt in NVIC of the eDMA reception channel */
+            S32_NVIC->ISER[0] = 1u << DMA_RX_Channel[i];
+        }
+        else
+        {
+            FlexCAN[i]->IMASK1 = CAN_IMASK1_BUF31TO0M(TX_MB_Mask | (g_rx_polling[i] ? 0u : RX_MB_Mask));
+        }
+
+        /* Start with an empty transmission queue, every transmission MB inactive and the default lanes */
+        g_tx_queue[i].count    = 0;
+        g_tx_queue[i].reserved = 0;
+        g_ready_mask           = (g_ready_mask & ~InterfaceGroup::readyRX(i + 1u)) | InterfaceGroup::readyTX(i + 1u);
+        g_tx_MB_busy[i]        = 0;
+        g_tx_MB_aborting[i]    = 0;
+        g_tx_MB_pinned[i]      = 0;
+        g_tx_MB_timed[i]       = 0;
+        g_tx_MB_loaned[i]      = 0;
+        g_tx_loaned[i]         = false;
+        g_submit_ring[i].enqueue.store(0u, std::memory_order_relaxed);
+        g_submit_ring[i].dequeue = 0;
+        for (std::uint32_t j = 0; j < Submit_Ring_Capacity; j++)
+        {
+            g_submit_ring[i].slots[j].sequence.store(j, std::memory_order_relaxed);
+        }
+        for (std::uint8_t j = 0; j < InterfaceGroup::CalendarLength; j++)
+        {
+            g_calendar[i][j].state = Timed_Free;
+        }
+        for (std::uint8_t j = 0; j < TX_MB_Count; j++)
+        {
+            g_tx_lane_priority[i][j] = Default_TX_Lane_Priority[j];
+        }
 
         /* Exit from freeze mode */
         FlexCAN[i]->MCR &= ~(CAN_MCR_HALT_MASK | CAN_MCR_FRZ_MASK);
@@ -879,15 +5239,67 @@ extern "C"
      * in function of the number of instances available in the target MCU, the names match the ones from the defined
      * interrupt vector table from the startup code located in the startup_S32K14x.S file.
      */
-    void CAN0_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler(0u); }
+    void CAN0_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler<0u>(); }
 
 #if defined(MCU_S32K146) || defined(MCU_S32K148)
     /* Interrupt for the 1st FlexCAN instance if available */
-    void CAN1_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler(1u); }
+    void CAN1_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler<1u>(); }
 #endif
 
 #if defined(MCU_S32K148)
     /* Interrupt for the 2nd FlexCAN instance if available */
-    void CAN2_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler(2u); }
+    void CAN2_ORed_0_15_MB_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_ISR_handler<2u>(); }
+#endif
+
+#if UAVCAN_CLASSIC_CAN
+    /* eDMA major loop interrupts of the 0th FlexCAN instance's reception channel, in classic mode */
+    void DMA0_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_RX_ISR_handler<0u>(); }
+
+#if defined(MCU_S32K146) || defined(MCU_S32K148)
+    /* eDMA major loop interrupts of the 1st FlexCAN instance's reception channel, in classic mode */
+    void DMA2_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_RX_ISR_handler<1u>(); }
+#endif
+
+#if defined(MCU_S32K148)
+    /* eDMA major loop interrupts of the 2nd FlexCAN instance's reception channel, in classic mode */
+    void DMA4_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_RX_ISR_handler<2u>(); }
+#endif
+#endif
+
+#if UAVCAN_DMA_PAYLOAD
+    /* eDMA completion interrupts of the 0th FlexCAN instance's transmission channel */
+    void DMA1_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_TX_ISR_handler<0u>(); }
+
+#if defined(MCU_S32K146) || defined(MCU_S32K148)
+    /* eDMA completion interrupts of the 1st FlexCAN instance's transmission channel */
+    void DMA3_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_TX_ISR_handler<1u>(); }
+#endif
+
+#if defined(MCU_S32K148)
+    /* eDMA completion interrupts of the 2nd FlexCAN instance's transmission channel */
+    void DMA5_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::DMA_TX_ISR_handler<2u>(); }
+#endif
+#endif
+
+    /* Expiration of LPIT channel 3 at the due time of the next periodic publication */
+    void LPIT0_Ch3_IRQHandler() { libuavcan::media::S32K::FlexCAN_interrupt::publication_ISR_handler(); }
+
+#if UAVCAN_DEFERRED_RX
+    /*
+     * PendSV exception, pended by the ISR of the instances configured with deferred reception for running their
+     * bottom half, instances without it return immediately.
+     */
+    void PendSV_Handler()
+    {
+        libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_bottom_half<0u>();
+
+#if defined(MCU_S32K146) || defined(MCU_S32K148)
+        libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_bottom_half<1u>();
+#endif
+
+#if defined(MCU_S32K148)
+        libuavcan::media::S32K::FlexCAN_interrupt::S32K_libuavcan_bottom_half<2u>();
+#endif
+    }
 #endif
 }
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/*
+ * Source file of the bulk data streaming engine, it only relies on the abstract media layer interface group
+ * so it builds for the target and for host nodes alike.
+ */
+
+/* Streaming engine header file */
+#include "libuavcan/media/S32K/stream.hpp"
+
+/* STL algorithms for the chunk copies */
+#include <algorithm>
+
+namespace libuavcan
+{
+namespace media
+{
+namespace S32K
+{
+/* Bytes of the data frames' header: sequence number (little-endian 16-bit), flags and length of the chunk */
+constexpr static std::uint8_t Chunk_Header_Bytes = 4u;
+
+/* Flag of the data frame carrying the last chunk of the blob */
+constexpr static std::uint8_t Chunk_Flag_Last = 0x01u;
+
+/* Bytes of the acknowledgement frames: next expected sequence number (little-endian 16-bit), bitmap of the 32
+ * following ones (little-endian 32-bit), flags and a reserved byte */
+constexpr static std::uint8_t Ack_Bytes = 8u;
+
+/* Flag of the acknowledgement of a complete blob */
+constexpr static std::uint8_t Ack_Flag_Complete = 0x01u;
+
+/* Chunks received in order between two acknowledgements, a gap or the last chunk are acknowledged right away */
+constexpr static std::uint8_t Ack_Interval = 8u;
+
+/* Frames acknowledged past a missing one before it's retransmitted, the two transmission MB's can swap the order of
+ * consecutive frames on the bus so a single frame past it isn't a loss yet */
+constexpr static std::uint32_t Reorder_Tolerance = 2u;
+
+/* Default retransmission timeout in microseconds and consecutive timeouts of the oldest frame before failing */
+constexpr static std::int64_t Default_Retransmit_Timeout = 10000;
+constexpr static std::uint8_t Default_Max_Retries        = 8u;
+
+/*
+ * Helper function for the absolute sequence number closest to a reference from its 16 bits transmitted.
+ * param  wire       The transmitted 16 bits.
+ * param  reference  An absolute sequence number within 32768 of the transmitted one.
+ * return The absolute sequence number.
+ */
+static std::uint32_t unwrap_Seq(std::uint16_t wire, std::uint32_t reference)
+{
+    std::int16_t delta = static_cast<std::int16_t>(static_cast<std::uint16_t>(wire - reference));
+
+    return reference + static_cast<std::uint32_t>(static_cast<std::int32_t>(delta));
+}
+
+BulkStream::BulkStream(GroupType&        group,
+                       std::uint_fast8_t interface_index,
+                       std::uint32_t     data_id,
+                       std::uint32_t     ack_id)
+    : group_(group)
+    , interface_index_(interface_index)
+    , data_id_(data_id)
+    , ack_id_(ack_id)
+    , role_(Role::Idle)
+    , blob_(nullptr)
+    , blob_length_(0)
+    , chunk_count_(0)
+    , base_(0)
+    , next_(0)
+    , acked_(0)
+    , fast_done_(0)
+    , highest_(0)
+    , retries_(0)
+    , max_retries_(Default_Max_Retries)
+    , retransmit_timeout_(libuavcan::duration::Monotonic::fromMicrosecond(Default_Retransmit_Timeout))
+    , sent_()
+    , sink_(nullptr)
+    , context_(nullptr)
+    , expected_(0)
+    , received_(0)
+    , last_seq_(0)
+    , unacked_(0)
+    , ack_pending_(false)
+    , statistics_()
+    , first_()
+    , started_(false)
+{}
+
+Result BulkStream::send(const std::uint8_t* blob, std::uint32_t blob_length, libuavcan::time::Monotonic now)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if (!blob || !blob_length)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        role_        = Role::Sender;
+        blob_        = blob;
+        blob_length_ = blob_length;
+        chunk_count_ = static_cast<std::uint32_t>((blob_length + ChunkBytes - 1u) / ChunkBytes);
+        base_        = 0;
+        next_        = 0;
+        acked_       = 0;
+        fast_done_   = 0;
+        highest_     = 0;
+        retries_     = 0;
+        statistics_  = {};
+        started_     = false;
+        stamp(now);
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result BulkStream::listen(Sink sink, void* context)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if (!sink)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        role_        = Role::Receiver;
+        sink_        = sink;
+        context_     = context;
+        expected_    = 0;
+        received_    = 0;
+        last_seq_    = 0;
+        unacked_     = 0;
+        ack_pending_ = false;
+        statistics_  = {};
+        started_     = false;
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result BulkStream::accept(const FrameType& frame, libuavcan::time::Monotonic now)
+{
+    /* Initialize return value status */
+    Result Status = Result::SuccessNothing;
+
+    if ((role_ == Role::Sender) && (frame.id == ack_id_))
+    {
+        accept_Ack(frame, now);
+        Status = Result::Success;
+    }
+    else if ((role_ == Role::Receiver) && (frame.id == data_id_))
+    {
+        accept_Chunk(frame, now);
+        Status = Result::Success;
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result BulkStream::poll(libuavcan::time::Monotonic now)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    if (role_ == Role::Receiver)
+    {
+        /* Flush an acknowledgement that found the transmission queue full */
+        if (ack_pending_ && transmit_Ack())
+        {
+            ack_pending_ = false;
+            unacked_     = 0;
+        }
+
+        if (last_seq_ && (expected_ == last_seq_))
+        {
+            Status = Result::SuccessNothing;
+        }
+    }
+    else if ((role_ != Role::Sender) || (base_ == chunk_count_))
+    {
+        Status = Result::SuccessNothing;
+    }
+    else
+    {
+        /* Retransmissions first, oldest first, of the frames timed out or left behind by later acknowledged ones */
+        bool queue_full = false;
+        for (std::uint32_t seq = base_; !queue_full && (seq != next_); seq++)
+        {
+            std::uint32_t bit = 1u << (seq - base_);
+            bool          timed_out =
+                (now.toMicrosecond() - sent_[seq % Window].toMicrosecond()) >=
+                static_cast<std::uint64_t>(retransmit_timeout_.toMicrosecond());
+            bool gap = !(fast_done_ & bit) &&
+                       (static_cast<std::int32_t>(highest_ - seq) > static_cast<std::int32_t>(Reorder_Tolerance));
+
+            if ((acked_ & bit) || !(timed_out || gap))
+            {
+                continue;
+            }
+
+            /* The oldest frame timing out again and again means the receiver is gone */
+            if (timed_out && (seq == base_) && (retries_++ >= max_retries_))
+            {
+                role_  = Role::Idle;
+                Status = Result::Failure;
+                break;
+            }
+
+            queue_full = !transmit_Chunk(seq, now);
+            if (!queue_full)
+            {
+                fast_done_ |= bit;
+                statistics_.retransmitted++;
+            }
+        }
+
+        /* Fill the rest of the window with new frames, as many as the transmission queue takes */
+        while (isSuccess(Status) && !queue_full && (next_ != chunk_count_) && ((next_ - base_) < Window))
+        {
+            queue_full = !transmit_Chunk(next_, now);
+            if (!queue_full)
+            {
+                next_++;
+            }
+        }
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result BulkStream::setRetransmitTimeout(libuavcan::duration::Monotonic timeout, std::uint8_t max_retries)
+{
+    /* Initialize return value status */
+    Result Status = Result::Success;
+
+    /* Input validation */
+    if (timeout.toMicrosecond() <= 0)
+    {
+        Status = Result::BadArgument;
+    }
+
+    if (isSuccess(Status))
+    {
+        retransmit_timeout_ = timeout;
+        max_retries_        = max_retries;
+    }
+
+    /* Return status code */
+    return Status;
+}
+
+Result BulkStream::getStatistics(StreamStatistics& out_statistics) const
+{
+    out_statistics = statistics_;
+
+    /* Return status code */
+    return Result::Success;
+}
+
+std::uint32_t BulkStream::getThroughput() const
+{
+    std::uint64_t throughput = 0u;
+
+    if (statistics_.elapsed)
+    {
+        throughput = (static_cast<std::uint64_t>(statistics_.bytes) * 1000000u) / statistics_.elapsed;
+    }
+
+    return static_cast<std::uint32_t>(throughput);
+}
+
+std::uint32_t BulkStream::getThroughputMBps() const
+{
+    /* Thousandths of MB/s are kB/s, rounded to the nearest */
+    return (getThroughput() + 500u) / 1000u;
+}
+
+bool BulkStream::transmit_Frame(std::uint32_t id, const std::uint8_t* payload, std::uint_fast8_t length)
+{
+    const FrameType frames[GroupType::TxFramesLen] = {FrameType(id, payload, FrameType::lengthToDlc(length))};
+    std::size_t     frames_written                 = 0;
+
+    return isSuccess(group_.write(interface_index_, frames, 1u, frames_written)) && frames_written;
+}
+
+bool BulkStream::transmit_Chunk(std::uint32_t seq, libuavcan::time::Monotonic now)
+{
+    /* Padding of the last frame up to its DLC stays zeroed */
+    std::uint8_t  payload[FrameType::MTUBytes] = {};
+    std::uint32_t offset                       = seq * ChunkBytes;
+    std::uint8_t  length = static_cast<std::uint8_t>(std::min<std::uint32_t>(ChunkBytes, blob_length_ - offset));
+
+    payload[0] = static_cast<std::uint8_t>(seq);
+    payload[1] = static_cast<std::uint8_t>(seq >> 8);
+    payload[2] = ((seq + 1u) == chunk_count_) ? Chunk_Flag_Last : 0u;
+    payload[3] = length;
+    std::copy(blob_ + offset, blob_ + offset + length, payload + Chunk_Header_Bytes);
+
+    bool queued = transmit_Frame(data_id_, payload, static_cast<std::uint_fast8_t>(Chunk_Header_Bytes + length));
+    if (queued)
+    {
+        sent_[seq % Window] = now;
+        statistics_.frames++;
+    }
+
+    return queued;
+}
+
+bool BulkStream::transmit_Ack()
+{
+    std::uint8_t payload[Ack_Bytes] = {};
+
+    payload[0] = static_cast<std::uint8_t>(expected_);
+    payload[1] = static_cast<std::uint8_t>(expected_ >> 8);
+    payload[2] = static_cast<std::uint8_t>(received_);
+    payload[3] = static_cast<std::uint8_t>(received_ >> 8);
+    payload[4] = static_cast<std::uint8_t>(received_ >> 16);
+    payload[5] = static_cast<std::uint8_t>(received_ >> 24);
+    payload[6] = (last_seq_ && (expected_ == last_seq_)) ? Ack_Flag_Complete : 0u;
+
+    bool queued = transmit_Frame(ack_id_, payload, Ack_Bytes);
+    if (queued)
+    {
+        statistics_.acks++;
+    }
+
+    return queued;
+}
+
+void BulkStream::accept_Ack(const FrameType& frame, libuavcan::time::Monotonic now)
+{
+    if (frame.getDataLength() < Ack_Bytes)
+    {
+        return;
+    }
+
+    /* Acknowledgements beyond the frames sent are bogus */
+    std::uint32_t cumulative = unwrap_Seq(static_cast<std::uint16_t>(frame.data[0] | (frame.data[1] << 8)), base_);
+    if (static_cast<std::int32_t>(next_ - cumulative) < 0)
+    {
+        return;
+    }
+
+    statistics_.acks++;
+    stamp(now);
+
+    /* Slide the window up to the next expected frame */
+    if (static_cast<std::int32_t>(cumulative - base_) > 0)
+    {
+        std::uint32_t shift = cumulative - base_;
+        acked_              = (shift < Window) ? (acked_ >> shift) : 0u;
+        fast_done_          = (shift < Window) ? (fast_done_ >> shift) : 0u;
+        base_               = cumulative;
+        retries_            = 0;
+        statistics_.bytes   = std::min(base_ * static_cast<std::uint32_t>(ChunkBytes), blob_length_);
+    }
+
+    /* Frames received past the acknowledgement's next expected one, which is behind the window when an older
+     * acknowledgement arrives late, limited to the ones in flight */
+    std::uint32_t bitmap = static_cast<std::uint32_t>(frame.data[2]) |
+                           (static_cast<std::uint32_t>(frame.data[3]) << 8) |
+                           (static_cast<std::uint32_t>(frame.data[4]) << 16) |
+                           (static_cast<std::uint32_t>(frame.data[5]) << 24);
+    for (std::uint32_t k = 0; bitmap; k++, bitmap >>= 1)
+    {
+        std::uint32_t offset = cumulative + 1u + k - base_;
+        if ((bitmap & 1u) && (offset < (next_ - base_)))
+        {
+            acked_ |= 1u << offset;
+        }
+    }
+
+    /* Highest frame known to have arrived, the missing ones far enough below it are lost */
+    if (static_cast<std::int32_t>(base_ - highest_) > 0)
+    {
+        highest_ = base_;
+    }
+    for (std::uint32_t k = Window; k > 0; k--)
+    {
+        if (acked_ & (1u << (k - 1u)))
+        {
+            if (static_cast<std::int32_t>(base_ + k - highest_) > 0)
+            {
+                highest_ = base_ + k;
+            }
+            break;
+        }
+    }
+}
+
+void BulkStream::accept_Chunk(const FrameType& frame, libuavcan::time::Monotonic now)
+{
+    std::uint_fast8_t frame_length = frame.getDataLength();
+    std::uint8_t      length       = (frame_length >= Chunk_Header_Bytes) ? frame.data[3] : 0u;
+
+    if (!length || (length > ChunkBytes) || ((Chunk_Header_Bytes + length) > frame_length))
+    {
+        return;
+    }
+
+    std::uint32_t seq   = unwrap_Seq(static_cast<std::uint16_t>(frame.data[0] | (frame.data[1] << 8)), expected_);
+    std::uint32_t delta = seq - expected_;
+
+    statistics_.frames++;
+    stamp(now);
+
+    /* Frames before the window or already held past its start are duplicates of lost acknowledgements, acknowledge
+     * again. Frames past the window are ignored, the sender never has them in flight */
+    bool stale = static_cast<std::int32_t>(delta) < 0;
+    if (stale || (delta && (delta <= Window) && (received_ & (1u << (delta - 1u)))))
+    {
+        statistics_.retransmitted++;
+        ack_pending_ = true;
+    }
+    else if (delta <= Window)
+    {
+        sink_(context_, seq * static_cast<std::uint32_t>(ChunkBytes), frame.data + Chunk_Header_Bytes, length);
+        statistics_.bytes += length;
+        unacked_++;
+
+        if (frame.data[2] & Chunk_Flag_Last)
+        {
+            last_seq_ = seq + 1u;
+        }
+
+        if (!delta)
+        {
+            /* Slide the window past the frames already held */
+            expected_++;
+            while (received_ & 1u)
+            {
+                received_ >>= 1;
+                expected_++;
+            }
+            received_ >>= 1;
+        }
+        else
+        {
+            /* A gap is acknowledged right away so the sender retransmits the missing frames early */
+            received_ |= 1u << (delta - 1u);
+            ack_pending_ = true;
+        }
+
+        if ((unacked_ >= Ack_Interval) || (last_seq_ && (expected_ == last_seq_)))
+        {
+            ack_pending_ = true;
+        }
+    }
+
+    if (ack_pending_ && transmit_Ack())
+    {
+        ack_pending_ = false;
+        unacked_     = 0;
+    }
+}
+
+void BulkStream::stamp(libuavcan::time::Monotonic now)
+{
+    if (!started_)
+    {
+        first_   = now;
+        started_ = true;
+    }
+
+    statistics_.elapsed = now.toMicrosecond() - first_.toMicrosecond();
+}
+
+}  // END namespace S32K
+}  // END namespace media
+}  // END namespace libuavcan
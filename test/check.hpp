@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/**
+ * @file
+ * Minimal checks shared by the host tests, each test is its own executable: a failed CHECK() is reported with its
+ * line and the case being run, and main() returns check_Report() as the exit code for ctest.
+ */
+
+#ifndef CHECK_HPP_INCLUDED
+#define CHECK_HPP_INCLUDED
+
+#include <cstdarg>
+#include <cstdio>
+
+/* Number of failed checks and description of the case being run */
+static int  g_check_failures = 0;
+static char g_check_case[96] = "";
+
+/*
+ * Describe the case being run for the failures reported from now on.
+ * param  format  printf() format of the description, followed by its arguments.
+ */
+static inline void check_Case(const char* format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    std::vsnprintf(g_check_case, sizeof(g_check_case), format, arguments);
+    va_end(arguments);
+}
+
+/*
+ * Count and report a failed check.
+ * param  condition   Result of the check.
+ * param  expression  Text of the checked expression.
+ * param  line        Line of the check.
+ */
+static inline void check(bool condition, const char* expression, int line)
+{
+    if (!condition)
+    {
+        std::printf("FAIL line %d, %s: %s\n", line, g_check_case, expression);
+        g_check_failures++;
+    }
+}
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+/*
+ * Report the outcome of a test.
+ * param  name  Name of the test in the report.
+ * return Exit code of the test, 0 if every check passed.
+ */
+static inline int check_Report(const char* name)
+{
+    if (g_check_failures)
+    {
+        std::printf("%d failures\n", g_check_failures);
+        return 1;
+    }
+
+    std::printf("%s passed\n", name);
+    return 0;
+}
+
+#endif  // CHECK_HPP_INCLUDED
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/**
+ * @file
+ * Host register model of the S32K14x eDMA engine. It holds the engine's register block and executes the transfer
+ * control descriptors the driver programs in it over host buffers mapped at the target's bus addresses, one minor
+ * loop per service request like the hardware: software starts, channel links within and at the end of the major
+ * loop, address offsets and modulos, minor loop offsets, last address adjustments and the completion flags.
+ */
+
+#ifndef EDMA_MODEL_HPP_INCLUDED
+#define EDMA_MODEL_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "libuavcan/media/S32K/edma.hpp"
+
+namespace libuavcan
+{
+namespace media
+{
+namespace S32K
+{
+/**
+ * Model of the eDMA engine, the descriptors are programmed straight into its register block.
+ */
+class EDMAModel
+{
+public:
+    /**
+     * Maximum number of host buffers mapped in the model's bus.
+     */
+    static constexpr std::size_t MaxRegions = 8u;
+
+    /**
+     * Register block of the engine, CR[EMLM] enables the minor loop mapping as on the target.
+     */
+    DMA_Type registers;
+
+    EDMAModel()
+        : registers()
+        , regions_()
+        , region_count_(0)
+        , fault_(false)
+    {}
+
+    /**
+     * Map a host buffer in the model's bus.
+     * @param [in]  address  Bus address of the buffer's first byte on the target.
+     * @param [in]  buffer   The host buffer.
+     * @param [in]  length   Length in bytes of the buffer.
+     */
+    void map(std::uint32_t address, void* buffer, std::size_t length)
+    {
+        if (region_count_ < MaxRegions)
+        {
+            regions_[region_count_++] = {address, static_cast<std::uint8_t*>(buffer), length};
+        }
+    }
+
+    /**
+     * Software start of a channel, as a write of its number into SSRT.
+     * @param [in]  channel  The eDMA channel.
+     */
+    void start(std::uint8_t channel)
+    {
+        registers.TCD[channel].CSR = static_cast<std::uint16_t>(
+            (registers.TCD[channel].CSR & ~DMA_TCD_CSR_DONE_MASK) | DMA_TCD_CSR_START_MASK);
+    }
+
+    /**
+     * Service the started channels, lowest channel first, until none is requesting service.
+     * @return Number of minor loops executed.
+     */
+    std::size_t run()
+    {
+        std::size_t minor_loops = 0;
+        bool        serviced    = true;
+
+        while (serviced && !fault_)
+        {
+            serviced = false;
+            for (std::uint8_t channel = 0; channel < DMA_TCD_COUNT; channel++)
+            {
+                if (registers.TCD[channel].CSR & DMA_TCD_CSR_START_MASK)
+                {
+                    minor_Loop(channel);
+                    minor_loops++;
+                    serviced = true;
+                    break;
+                }
+            }
+        }
+
+        return minor_loops;
+    }
+
+    /**
+     * Whether a channel's major loop interrupt is pending.
+     * @param [in]  channel  The eDMA channel.
+     * @return true if INT is set for the channel.
+     */
+    bool interrupt(std::uint8_t channel) const
+    {
+        return (registers.INT & (1u << channel)) != 0u;
+    }
+
+    /**
+     * Whether an access fell outside the mapped buffers or used an unsupported configuration, the model stops then.
+     * @return true after a fault.
+     */
+    bool fault() const
+    {
+        return fault_;
+    }
+
+private:
+    /* Host buffer mapped at a bus address */
+    struct Region
+    {
+        std::uint32_t address;
+        std::uint8_t* buffer;
+        std::size_t   length;
+    };
+
+    /* Host address of an access of a number of bytes, nullptr if it isn't fully within a mapped buffer */
+    std::uint8_t* host_Address(std::uint32_t address, std::size_t size)
+    {
+        for (std::size_t i = 0; i < region_count_; i++)
+        {
+            const Region& region = regions_[i];
+            if ((address >= region.address) && ((address - region.address + size) <= region.length))
+            {
+                return region.buffer + (address - region.address);
+            }
+        }
+
+        fault_ = true;
+        return nullptr;
+    }
+
+    /* Address incremented by a signed offset within its modulo, the upper bits stay fixed when the modulo is set */
+    static std::uint32_t advance(std::uint32_t address, std::int32_t offset, std::uint8_t modulo)
+    {
+        std::uint32_t next = address + static_cast<std::uint32_t>(offset);
+        if (modulo)
+        {
+            std::uint32_t mask = (1u << modulo) - 1u;
+            next               = (address & ~mask) | (next & mask);
+        }
+
+        return next;
+    }
+
+    /* Execute a single minor loop of a channel and the end of its major loop if it was the last one */
+    void minor_Loop(std::uint8_t channel)
+    {
+        auto& TCD = registers.TCD[channel];
+        TCD.CSR   = static_cast<std::uint16_t>((TCD.CSR & ~DMA_TCD_CSR_START_MASK) | DMA_TCD_CSR_ACTIVE_MASK);
+
+        /* Transfer attributes, only equal source and destination sizes of 1, 2 or 4 bytes are modeled */
+        const std::uint8_t  source_size = static_cast<std::uint8_t>((TCD.ATTR & DMA_TCD_ATTR_SSIZE_MASK) >> 8u);
+        const std::uint8_t  dest_size   = static_cast<std::uint8_t>(TCD.ATTR & DMA_TCD_ATTR_DSIZE_MASK);
+        const std::uint8_t  source_mod  = static_cast<std::uint8_t>((TCD.ATTR & DMA_TCD_ATTR_SMOD_MASK) >> 11u);
+        const std::uint8_t  dest_mod    = static_cast<std::uint8_t>((TCD.ATTR & DMA_TCD_ATTR_DMOD_MASK) >> 3u);
+        const std::uint32_t size        = 1u << source_size;
+        if ((source_size != dest_size) || (source_size > 2u))
+        {
+            fault_ = true;
+            return;
+        }
+
+        /* Minor loop byte count and offset as mapped by CR[EMLM] and the offset enables */
+        const std::uint32_t nbytes_word = TCD.NBYTES.MLNO;
+        const bool          mapping     = (registers.CR & DMA_CR_EMLM_MASK) != 0u;
+        const bool source_offset = mapping && (nbytes_word & DMA_TCD_NBYTES_MLOFFYES_SMLOE_MASK);
+        const bool dest_offset   = mapping && (nbytes_word & DMA_TCD_NBYTES_MLOFFYES_DMLOE_MASK);
+        std::uint32_t nbytes     = nbytes_word;
+        std::int32_t  offset     = 0;
+        if (source_offset || dest_offset)
+        {
+            nbytes = nbytes_word & DMA_TCD_NBYTES_MLOFFYES_NBYTES_MASK;
+            offset = static_cast<std::int32_t>((nbytes_word & DMA_TCD_NBYTES_MLOFFYES_MLOFF_MASK) << 2u) >> 12;
+        }
+        else if (mapping)
+        {
+            nbytes = nbytes_word & DMA_TCD_NBYTES_MLOFFNO_NBYTES_MASK;
+        }
+
+        std::uint32_t source      = TCD.SADDR;
+        std::uint32_t destination = TCD.DADDR;
+        for (std::uint32_t done = 0; !fault_ && (done < nbytes); done += size)
+        {
+            std::uint8_t* from = host_Address(source, size);
+            std::uint8_t* to   = host_Address(destination, size);
+            if (from && to)
+            {
+                std::memcpy(to, from, size);
+            }
+            source      = advance(source, static_cast<std::int16_t>(TCD.SOFF), source_mod);
+            destination = advance(destination, static_cast<std::int16_t>(TCD.DOFF), dest_mod);
+        }
+        if (source_offset)
+        {
+            source += static_cast<std::uint32_t>(offset);
+        }
+        if (dest_offset)
+        {
+            destination += static_cast<std::uint32_t>(offset);
+        }
+
+        /* Current major loop count, 9 bits wide when minor loop linking is enabled */
+        const bool          link     = (TCD.CITER.ELINKNO & DMA_TCD_CITER_ELINKYES_ELINK_MASK) != 0u;
+        const std::uint16_t count_mask =
+            link ? DMA_TCD_CITER_ELINKYES_CITER_LE_MASK : DMA_TCD_CITER_ELINKNO_CITER_MASK;
+        const std::uint16_t count = static_cast<std::uint16_t>((TCD.CITER.ELINKNO & count_mask) - 1u);
+        const std::uint16_t biter = static_cast<std::uint16_t>(TCD.BITER.ELINKNO & count_mask);
+
+        TCD.CSR = static_cast<std::uint16_t>(TCD.CSR & ~DMA_TCD_CSR_ACTIVE_MASK);
+        if (count)
+        {
+            TCD.SADDR         = source;
+            TCD.DADDR         = destination;
+            TCD.CITER.ELINKNO = static_cast<std::uint16_t>((TCD.CITER.ELINKNO & ~count_mask) | count);
+
+            if ((TCD.CSR & DMA_TCD_CSR_INTHALF_MASK) && (count == (biter >> 1)))
+            {
+                registers.INT |= 1u << channel;
+            }
+
+            /* The minor loop link isn't performed on the last minor loop */
+            if (link)
+            {
+                start(static_cast<std::uint8_t>((TCD.CITER.ELINKNO & DMA_TCD_CITER_ELINKYES_LINKCH_MASK) >> 9u));
+            }
+        }
+        else
+        {
+            /* End of the major loop */
+            TCD.SADDR         = source + TCD.SLAST;
+            TCD.DADDR         = destination + TCD.DLASTSGA;
+            TCD.CITER.ELINKNO = TCD.BITER.ELINKNO;
+            TCD.CSR           = static_cast<std::uint16_t>(TCD.CSR | DMA_TCD_CSR_DONE_MASK);
+
+            if (TCD.CSR & DMA_TCD_CSR_INTMAJOR_MASK)
+            {
+                registers.INT |= 1u << channel;
+            }
+            if (TCD.CSR & DMA_TCD_CSR_DREQ_MASK)
+            {
+                registers.ERQ &= ~(1u << channel);
+            }
+            if (TCD.CSR & DMA_TCD_CSR_MAJORELINK_MASK)
+            {
+                start(static_cast<std::uint8_t>((TCD.CSR & DMA_TCD_CSR_MAJORLINKCH_MASK) >> 8u));
+            }
+        }
+    }
+
+    Region      regions_[MaxRegions];
+    std::size_t region_count_;
+    bool        fault_;
+};
+
+}  // END namespace S32K
+}  // END namespace media
+}  // END namespace libuavcan
+
+#endif  // EDMA_MODEL_HPP_INCLUDED
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/**
+ * @file
+ * Host loopback interface group for the engines built on the abstract media layer. A simulated CAN-FD bus carries
+ * the frames between two nodes, each a single interface group with a bounded transmission queue. The bus arbitrates
+ * by CAN ID, runs on its own clock advanced by the duration of each frame at the 1 Mbit/s nominal and 4 Mbit/s data
+ * bit rates of the driver's defaults, and can lose frames or swap consecutive ones of a node, as its two transmission
+ * message buffers do on the target.
+ */
+
+#ifndef LOOPBACK_GROUP_HPP_INCLUDED
+#define LOOPBACK_GROUP_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "libuavcan/media/can.hpp"
+#include "libuavcan/media/interfaces.hpp"
+
+namespace libuavcan
+{
+namespace media
+{
+namespace S32K
+{
+/**
+ * Simulated bus between two loopback nodes, numbered 0 and 1.
+ */
+class LoopbackBus
+{
+public:
+    /**
+     * Frame type of the bus, 64-byte CAN-FD frames.
+     */
+    using FrameType = media::CAN::Frame<media::CAN::TypeFD::MaxFrameSizeBytes>;
+
+    /**
+     * Frames each node queues for transmission before write() reports its queue full.
+     */
+    static constexpr std::size_t QueueCapacity = 16u;
+
+    /**
+     * Create an idle bus at time 0.
+     * @param [in]  loss_per_mille     Probability of a transmitted frame being lost, in thousandths.
+     * @param [in]  reorder_per_mille  Probability of a node's second queued frame overtaking the first one, in
+     *                                 thousandths. A frame is overtaken once at most, as by the other MB.
+     * @param [in]  seed               Non zero seed of the pseudo random losses and swaps.
+     */
+    LoopbackBus(std::uint32_t loss_per_mille, std::uint32_t reorder_per_mille, std::uint32_t seed)
+        : loss_per_mille_(loss_per_mille)
+        , reorder_per_mille_(reorder_per_mille)
+        , random_(seed ? seed : 1u)
+        , time_ns_(0)
+        , transmitted_(0)
+        , lost_(0)
+        , swapped_(0)
+    {}
+
+    /**
+     * Queue a frame of a node for transmission.
+     * @param [in]  node   The transmitting node.
+     * @param [in]  frame  The frame.
+     * @return false if the node's queue is full.
+     */
+    bool enqueue(std::uint8_t node, const FrameType& frame)
+    {
+        Node& sender = nodes_[node];
+        if (sender.tx.size() >= QueueCapacity)
+        {
+            return false;
+        }
+
+        sender.tx.push_back(frame);
+        return true;
+    }
+
+    /**
+     * Take the oldest frame received by a node.
+     * @param [in]  node       The receiving node.
+     * @param [out] out_frame  The frame, timestamped at the end of its transmission.
+     * @return false if the node received nothing.
+     */
+    bool dequeue(std::uint8_t node, FrameType& out_frame)
+    {
+        Node& receiver = nodes_[node];
+        if (receiver.rx.empty())
+        {
+            return false;
+        }
+
+        out_frame = receiver.rx.front();
+        receiver.rx.pop_front();
+        return true;
+    }
+
+    /**
+     * Whether a node received frames not taken yet.
+     * @param [in]  node  The receiving node.
+     */
+    bool pending(std::uint8_t node) const
+    {
+        return !nodes_[node].rx.empty();
+    }
+
+    /**
+     * Transmit the frame that wins the arbitration among the nodes' next ones and advance the clock by its duration,
+     * or by an idle period when no node has a frame queued.
+     * @param [in]  idle_us  Microseconds the clock advances by when the bus stays idle.
+     * @return false if the bus stayed idle.
+     */
+    bool step(std::uint32_t idle_us)
+    {
+        /* Next frame of each node, the second one when it overtakes the first */
+        std::size_t next[2] = {0u, 0u};
+        int         winner  = -1;
+        for (std::uint8_t i = 0; i < 2u; i++)
+        {
+            Node& node = nodes_[i];
+            if (node.tx.empty())
+            {
+                continue;
+            }
+            if ((node.tx.size() > 1u) && !node.overtaken && chance(reorder_per_mille_))
+            {
+                next[i] = 1u;
+            }
+            if ((winner < 0) || (node.tx[next[i]].id < nodes_[winner].tx[next[winner]].id))
+            {
+                winner = i;
+            }
+        }
+
+        if (winner < 0)
+        {
+            time_ns_ += static_cast<std::uint64_t>(idle_us) * 1000u;
+            return false;
+        }
+
+        Node&     sender = nodes_[winner];
+        FrameType frame  = sender.tx[next[winner]];
+        sender.tx.erase(sender.tx.begin() + static_cast<std::ptrdiff_t>(next[winner]));
+        sender.overtaken = next[winner] != 0u;
+        swapped_ += next[winner];
+
+        time_ns_ += frame_Duration(frame.getDataLength());
+        transmitted_++;
+
+        if (chance(loss_per_mille_))
+        {
+            lost_++;
+        }
+        else
+        {
+            frame.timestamp = now();
+            nodes_[1 - winner].rx.push_back(frame);
+        }
+
+        return true;
+    }
+
+    /**
+     * Current time of the bus.
+     */
+    libuavcan::time::Monotonic now() const
+    {
+        return libuavcan::time::Monotonic::fromMicrosecond(time_ns_ / 1000u);
+    }
+
+    /**
+     * Frames transmitted so far, lost ones included.
+     */
+    std::uint32_t transmitted() const
+    {
+        return transmitted_;
+    }
+
+    /**
+     * Frames lost so far.
+     */
+    std::uint32_t lost() const
+    {
+        return lost_;
+    }
+
+    /**
+     * Frames transmitted ahead of an older frame of their node so far.
+     */
+    std::uint32_t swapped() const
+    {
+        return swapped_;
+    }
+
+private:
+    /* Queues of a node, the transmitted frames and the received ones */
+    struct Node
+    {
+        std::deque<FrameType> tx;
+        std::deque<FrameType> rx;
+        bool                  overtaken = false; /* The frame at the queue's front was overtaken already */
+    };
+
+    /* Duration in nanoseconds of a frame with bit rate switch and an 29-bit ID: the arbitration, control and end of
+     * frame fields at 1 Mbit/s, the DLC, payload and CRC at 4 Mbit/s, without stuff bits */
+    static std::uint64_t frame_Duration(std::uint_fast8_t length)
+    {
+        const std::uint64_t nominal_bits = 36u + 12u;
+        const std::uint64_t data_bits    = 5u + 8u * length + ((length > 16u) ? 25u : 21u);
+
+        return nominal_bits * 1000u + data_bits * 250u;
+    }
+
+    /* Draw of a probability in thousandths from a xorshift generator */
+    bool chance(std::uint32_t per_mille)
+    {
+        random_ ^= random_ << 13;
+        random_ ^= random_ >> 17;
+        random_ ^= random_ << 5;
+
+        return (random_ % 1000u) < per_mille;
+    }
+
+    Node          nodes_[2];
+    std::uint32_t loss_per_mille_;
+    std::uint32_t reorder_per_mille_;
+    std::uint32_t random_;
+    std::uint64_t time_ns_;
+    std::uint32_t transmitted_;
+    std::uint32_t lost_;
+    std::uint32_t swapped_;
+};
+
+/**
+ * Interface group of a loopback node, a single interface with index 1 attached to the bus.
+ */
+class LoopbackGroup : public media::InterfaceGroup<LoopbackBus::FrameType>
+{
+public:
+    /**
+     * Attach a node to the bus.
+     * @param [in]  bus   The bus.
+     * @param [in]  node  The node's number on the bus, 0 or 1.
+     */
+    LoopbackGroup(LoopbackBus& bus, std::uint8_t node)
+        : bus_(bus)
+        , node_(node)
+    {}
+
+    virtual std::uint_fast8_t getInterfaceCount() const override
+    {
+        return 1u;
+    }
+
+    virtual libuavcan::Result write(std::uint_fast8_t interface_index,
+                                    const FrameType (&frames)[TxFramesLen],
+                                    std::size_t  frames_len,
+                                    std::size_t& out_frames_written) override
+    {
+        out_frames_written = 0;
+        if ((interface_index != 1u) || (frames_len > TxFramesLen))
+        {
+            return libuavcan::Result::BadArgument;
+        }
+
+        while ((out_frames_written < frames_len) && bus_.enqueue(node_, frames[out_frames_written]))
+        {
+            out_frames_written++;
+        }
+
+        if (out_frames_written == frames_len)
+        {
+            return libuavcan::Result::Success;
+        }
+        return out_frames_written ? libuavcan::Result::SuccessPartial : libuavcan::Result::BufferFull;
+    }
+
+    virtual libuavcan::Result read(std::uint_fast8_t interface_index,
+                                   FrameType (&out_frames)[RxFramesLen],
+                                   std::size_t& out_frames_read) override
+    {
+        out_frames_read = 0;
+        if (interface_index != 1u)
+        {
+            return libuavcan::Result::BadArgument;
+        }
+
+        if (bus_.dequeue(node_, out_frames[0]))
+        {
+            out_frames_read = 1u;
+        }
+        return libuavcan::Result::Success;
+    }
+
+    virtual libuavcan::Result reconfigureFilters(const typename FrameType::Filter* filter_config,
+                                                 std::size_t                       filter_config_length) override
+    {
+        static_cast<void>(filter_config);
+        static_cast<void>(filter_config_length);
+        return libuavcan::Result::NotImplemented;
+    }
+
+    /* The bus only moves when stepped, a node is ready for reading or else for writing */
+    virtual libuavcan::Result select(libuavcan::duration::Monotonic timeout, bool ignore_write_available) override
+    {
+        static_cast<void>(timeout);
+        return (bus_.pending(node_) || !ignore_write_available) ? libuavcan::Result::Success
+                                                                 : libuavcan::Result::SuccessTimeout;
+    }
+
+private:
+    LoopbackBus& bus_;
+    std::uint8_t node_;
+};
+
+}  // END namespace S32K
+}  // END namespace media
+}  // END namespace libuavcan
+
+#endif  // LOOPBACK_GROUP_HPP_INCLUDED
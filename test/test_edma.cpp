@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/*
+ * Host test of the eDMA payload copies: the descriptors programmed by edma_ProgramCopy() are executed by the eDMA
+ * register model between a frame's payload in SRAM and a message buffer in the FlexCAN RAM, for every payload length.
+ */
+
+#include "check.hpp"
+#include "edma_model.hpp"
+
+using libuavcan::media::S32K::EDMAModel;
+using libuavcan::media::S32K::edma_ProgramCopy;
+
+/* Bus addresses of the payload of the first message buffer of FlexCAN0 and of a frame in SRAM */
+constexpr static std::uint32_t MB_Payload_Address = 0x40024088u;
+constexpr static std::uint32_t Frame_Address      = 0x20000100u;
+
+/* eDMA channel of the transmission copies of FlexCAN0 */
+constexpr static std::uint8_t Channel = 1u;
+
+/* Value of the words not covered by the payload, which must not be written */
+constexpr static std::uint32_t Sentinel = 0xA5A5A5A5u;
+
+/*
+ * Copy a payload of a number of words from a frame into a message buffer and check the message buffer's words.
+ * param  words      Number of 32-bit words of the payload.
+ * param  byte_swap  Whether the copy reverses the bytes of each word, as for the transmission payloads.
+ */
+static void test_Copy(unsigned words, bool byte_swap)
+{
+    check_Case("%u words%s", words, byte_swap ? " byte swapped" : "");
+
+    std::uint8_t  frame[64];
+    std::uint32_t MB_payload[17];
+    for (unsigned i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<std::uint8_t>(0x10u + i);
+    }
+    for (std::uint32_t& word : MB_payload)
+    {
+        word = Sentinel;
+    }
+
+    EDMAModel model;
+    model.registers.CR |= DMA_CR_EMLM_MASK;
+    model.map(Frame_Address, frame, sizeof(frame));
+    model.map(MB_Payload_Address, MB_payload, sizeof(MB_payload));
+
+    edma_ProgramCopy(model.registers.TCD[Channel], Channel, Frame_Address, MB_Payload_Address,
+                     static_cast<std::uint8_t>(words), byte_swap);
+
+    /* A single software start completes the whole copy */
+    model.start(Channel);
+    std::size_t minor_loops = model.run();
+
+    CHECK(!model.fault());
+    CHECK(minor_loops == (byte_swap ? words : 1u));
+    CHECK(model.interrupt(Channel));
+    CHECK(model.registers.TCD[Channel].CSR & DMA_TCD_CSR_DONE_MASK);
+    CHECK(!(model.registers.TCD[Channel].CSR & DMA_TCD_CSR_START_MASK));
+
+    /* FlexCAN transmits the most significant byte of each word first, so a swapped word holds the frame's bytes in
+     * order from the most significant one */
+    for (unsigned i = 0; i < words; i++)
+    {
+        std::uint32_t native = static_cast<std::uint32_t>(frame[4 * i]) |
+                               (static_cast<std::uint32_t>(frame[4 * i + 1]) << 8) |
+                               (static_cast<std::uint32_t>(frame[4 * i + 2]) << 16) |
+                               (static_cast<std::uint32_t>(frame[4 * i + 3]) << 24);
+        std::uint32_t swapped = (native >> 24) | ((native >> 8) & 0xFF00u) | ((native << 8) & 0xFF0000u) |
+                                (native << 24);
+        CHECK(MB_payload[i] == (byte_swap ? swapped : native));
+    }
+    for (unsigned i = words; i < 17u; i++)
+    {
+        CHECK(MB_payload[i] == Sentinel);
+    }
+}
+
+int main()
+{
+    for (unsigned words = 1; words <= 16u; words++)
+    {
+        test_Copy(words, true);
+        test_Copy(words, false);
+    }
+
+    return check_Report("eDMA payload copies");
+}
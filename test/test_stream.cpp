@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NXP. All rights reserved.
+ * Distributed under The MIT License.
+ * Author: Abraham Rodriguez <abraham.rodriguez@nxp.com>
+ */
+
+/*
+ * Host test of the bulk streaming engine: a blob is streamed between a sender and a receiver node of the loopback
+ * bus, with and without lost and reordered frames. The blob must arrive complete with each chunk written once, and
+ * the sustained throughput over the bus' simulated time is reported in MB/s.
+ */
+
+#include <vector>
+
+#include "libuavcan/media/S32K/stream.hpp"
+#include "check.hpp"
+#include "loopback_group.hpp"
+
+using libuavcan::media::S32K::BulkStream;
+using libuavcan::media::S32K::LoopbackBus;
+using libuavcan::media::S32K::LoopbackGroup;
+
+/* CAN ID's of the stream, the acknowledgements win the arbitration against the data frames */
+constexpr static std::uint32_t Data_ID = 0x1234u;
+constexpr static std::uint32_t Ack_ID  = 0x1233u;
+
+/* Microseconds the bus clock advances by while it's idle, for the retransmission timeouts to expire */
+constexpr static std::uint32_t Idle_Step = 100u;
+
+/* Bus steps after which a stream that didn't complete is a failure */
+constexpr static std::uint32_t Max_Steps = 2000000u;
+
+/* Destination of the received blob, with the number of writes of each chunk */
+struct Destination
+{
+    std::vector<std::uint8_t>  data;
+    std::vector<std::uint32_t> writes;
+    bool                       misplaced;
+};
+
+static void sink(void* context, std::uint32_t offset, const std::uint8_t* data, std::size_t length)
+{
+    Destination& destination = *static_cast<Destination*>(context);
+    if (((offset % BulkStream::ChunkBytes) != 0u) || ((offset + length) > destination.data.size()))
+    {
+        destination.misplaced = true;
+        return;
+    }
+
+    std::copy(data, data + length, destination.data.begin() + offset);
+    destination.writes[offset / BulkStream::ChunkBytes]++;
+}
+
+/* Hand every frame received by a node to its stream */
+static void deliver(LoopbackGroup& group, BulkStream& stream)
+{
+    LoopbackGroup::FrameType frames[LoopbackGroup::RxFramesLen];
+    std::size_t              frames_read = 0;
+
+    while (isSuccess(group.read(1u, frames, frames_read)) && frames_read)
+    {
+        static_cast<void>(stream.accept(frames[0], frames[0].timestamp));
+    }
+}
+
+/*
+ * Stream a blob between two nodes of a loopback bus and check it arrived intact.
+ * param  name               Name of the case in the report.
+ * param  blob_length        Length in bytes of the blob.
+ * param  loss_per_mille     Probability of a lost frame, in thousandths.
+ * param  reorder_per_mille  Probability of a node's frames being swapped, in thousandths.
+ */
+static void test_Stream(const char*   name,
+                        std::uint32_t blob_length,
+                        std::uint32_t loss_per_mille,
+                        std::uint32_t reorder_per_mille)
+{
+    check_Case("%s", name);
+
+    std::vector<std::uint8_t> blob(blob_length);
+    for (std::uint32_t i = 0; i < blob_length; i++)
+    {
+        blob[i] = static_cast<std::uint8_t>((i * 7u) ^ (i >> 8));
+    }
+
+    Destination destination = {std::vector<std::uint8_t>(blob_length),
+                               std::vector<std::uint32_t>((blob_length + BulkStream::ChunkBytes - 1u) /
+                                                          BulkStream::ChunkBytes),
+                               false};
+
+    LoopbackBus   bus(loss_per_mille, reorder_per_mille, 0x2545F491u);
+    LoopbackGroup sender_group(bus, 0u);
+    LoopbackGroup receiver_group(bus, 1u);
+    BulkStream    sender(sender_group, 1u, Data_ID, Ack_ID);
+    BulkStream    receiver(receiver_group, 1u, Data_ID, Ack_ID);
+
+    CHECK(receiver.listen(sink, &destination) == libuavcan::Result::Success);
+    CHECK(sender.send(blob.data(), blob_length, bus.now()) == libuavcan::Result::Success);
+
+    /* Run both nodes until the sender has the whole blob acknowledged */
+    libuavcan::Result sender_status = libuavcan::Result::Success;
+    for (std::uint32_t steps = 0; (sender_status == libuavcan::Result::Success) && (steps < Max_Steps); steps++)
+    {
+        deliver(sender_group, sender);
+        deliver(receiver_group, receiver);
+        sender_status = sender.poll(bus.now());
+        static_cast<void>(receiver.poll(bus.now()));
+        static_cast<void>(bus.step(Idle_Step));
+    }
+
+    BulkStream::StreamStatistics sent     = {};
+    BulkStream::StreamStatistics received = {};
+    CHECK(sender.getStatistics(sent) == libuavcan::Result::Success);
+    CHECK(receiver.getStatistics(received) == libuavcan::Result::Success);
+
+    CHECK(sender_status == libuavcan::Result::SuccessNothing);
+    CHECK(receiver.poll(bus.now()) == libuavcan::Result::SuccessNothing);
+    CHECK(!destination.misplaced);
+    CHECK(destination.data == blob);
+    for (std::uint32_t writes : destination.writes)
+    {
+        CHECK(writes == 1u);
+    }
+    CHECK(sent.bytes == blob_length);
+    CHECK(received.bytes == blob_length);
+
+    /* Swaps of consecutive frames are within the reordering tolerance, only losses cause retransmissions */
+    if (!loss_per_mille)
+    {
+        CHECK(sent.retransmitted == 0u);
+    }
+    else
+    {
+        CHECK(sent.retransmitted > 0u);
+    }
+
+    const std::uint32_t MBps = sender.getThroughputMBps();
+    std::printf("%-18s %7u bytes, %5u frames (%4u lost, %4u swapped), %4u retransmitted, %u.%03u MB/s\n", name,
+                blob_length, bus.transmitted(), bus.lost(), bus.swapped(), sent.retransmitted, MBps / 1000u,
+                MBps % 1000u);
+}
+
+int main()
+{
+    test_Stream("clean", 65536u, 0u, 0u);
+    test_Stream("short", 59u, 0u, 0u);
+    test_Stream("reordered", 65536u, 0u, 100u);
+    test_Stream("lossy", 65536u, 20u, 0u);
+    test_Stream("lossy reordered", 65536u, 50u, 100u);
+
+    return check_Report("Bulk streams");
+}